@@ -0,0 +1,52 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <atomic>
+
+// Tek üretici / tek tüketici (SPSC) kilitsiz halka tampon.
+// Üretici yalnızca head'i, tüketici yalnızca tail'i yazar; N ikinin kuvveti olmalı.
+template <typename T, size_t N>
+class SpscQueue {
+  static_assert((N & (N - 1)) == 0, "SpscQueue boyutu ikinin kuvveti olmali");
+public:
+  bool push(const T &item) {
+    size_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) >= N) return false; // dolu
+    _items[head & (N - 1)] = item;
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+  bool pop(T &item) {
+    size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) return false; // boş
+    item = _items[tail & (N - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+  bool empty() const {
+    return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire);
+  }
+private:
+  T _items[N];
+  std::atomic<size_t> _head{0};
+  std::atomic<size_t> _tail{0};
+};
+
+// Web tarafından ritim motoruna gönderilen ayar komutları.
+// SET_* komutları tek bir alanı yazar; APPLY_VALVE değişiklikleri devreye alır
+// (value != 0 ise atış baştan başlatılır). Özel dalga komutlarında value paketlidir:
+// SET_CUSTOM_WAVE_LENGTH = (sampleMs << 8) | uzunluk, SET_CUSTOM_WAVE_SAMPLE = (indeks << 8) | %.
+// BEGIN_BULK ile COMMIT_BULK arasındaki SET_* ve APPLY_VALVE komutları bekletilir ve
+// hepsi birlikte, etkilenen valflerden birinin sıradaki atış başlangıcında devreye girer.
+enum ValveCommandType : uint8_t {
+  SET_STATE, SET_MODE, SET_PWM_VALUE, SET_HEART_RATE, SET_DYNAMIC_PULSE, SET_MANUAL_PULSE_DURATION, SET_USE_PQRST,
+  SET_P_WAVE_DURATION, SET_PR_SEGMENT_DURATION, SET_R_WAVE_DURATION, SET_ST_SEGMENT_DURATION, SET_T_WAVE_DURATION,
+  SET_P_WAVE_PWM, SET_R_WAVE_PWM, SET_T_WAVE_PWM, SET_WAVE_SHAPE, SET_PULSE_DELAY, SET_CUSTOM_WAVE_LENGTH,
+  SET_CUSTOM_WAVE_SAMPLE, APPLY_VALVE, BEGIN_BULK, COMMIT_BULK
+};
+
+struct ValveCommand {
+  uint8_t valve; ValveCommandType type; int32_t value;
+};
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdarg.h>
+#include <esp_timer.h>
+
+// Cihaz içi performans ölçümleri; /metrics adresinden Prometheus metin biçiminde okunur.
+// Her sayaç ve histogramı tek bir görev yazar (ritim motoru ya da web görevi), okuma kilitsizdir.
+// 64 bitlik toplamlar okunurken nadiren yırtılabilir; ölçüm amaçlı olduğundan kabul edilir.
+// Süreler mikrosaniye cinsindendir.
+
+#define METRIC_BUCKET_COUNT 12
+#define MAX_HTTP_ROUTES 20
+#define METRICS_LINE_MAX 192 // tek satırın en uzun hali; tampon bundan azsa önce gönderilir
+
+static const uint32_t METRIC_BUCKETS_US[METRIC_BUCKET_COUNT] = {
+  10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 100000
+};
+
+struct MetricSummary {
+  uint32_t count; uint64_t sum; uint32_t max;
+};
+
+// Kovalar birikimli değildir; birikimli toplam yazarken hesaplanır. Son kova +Inf.
+struct Histogram {
+  uint32_t buckets[METRIC_BUCKET_COUNT + 1]; MetricSummary summary;
+};
+
+struct HttpRouteMetrics {
+  const char *route; const char *method; Histogram latency;
+};
+
+// Ritim motoru yazar
+static Histogram engineTickUs;                 // runRhythmEngineOnce() süresi
+static Histogram edgeLatenessUs;               // planlanan ile işlenen geçiş arasındaki fark
+static MetricSummary valveLatenessUs[NUM_VALVES];
+static uint32_t solenoidDutyCalls = 0;         // setSolenoidDuty() çağrıları
+static uint32_t solenoidDutyChanges = 0;       // değeri gerçekten değişenler
+static uint32_t i2cTransactions = 0;
+static uint32_t i2cChannelWrites = 0;          // burst içinde yazılan kanal sayısı
+static uint32_t i2cErrors = 0;
+static Histogram i2cLatencyUs;
+
+// Web görevi yazar
+static Histogram settingsWriteUs;              // ayar dosyasının flash'a yazılması
+static HttpRouteMetrics httpRoutes[MAX_HTTP_ROUTES];
+static uint8_t httpRouteCount = 0;
+
+inline uint32_t metricsElapsedUs(uint64_t start) {
+  return (uint32_t)((uint64_t)esp_timer_get_time() - start);
+}
+
+inline void observeSummary(MetricSummary &summary, uint32_t value) {
+  summary.count++;
+  summary.sum += value;
+  if (value > summary.max) summary.max = value;
+}
+
+inline void observeHistogram(Histogram &histogram, uint32_t value) {
+  int bucket = 0;
+  while (bucket < METRIC_BUCKET_COUNT && value > METRIC_BUCKETS_US[bucket]) bucket++;
+  histogram.buckets[bucket]++;
+  observeSummary(histogram.summary, value);
+}
+
+inline void recordEdgeLateness(int valveIndex, uint32_t latenessUs) {
+  observeHistogram(edgeLatenessUs, latenessUs);
+  observeSummary(valveLatenessUs[valveIndex], latenessUs);
+}
+
+// Açılışta rota başına bir kez çağrılır; tablo doluysa NULL döner (rota ölçülmez).
+Histogram *registerHttpRoute(const char *route, const char *method) {
+  if (httpRouteCount >= MAX_HTTP_ROUTES) return NULL;
+  HttpRouteMetrics &metrics = httpRoutes[httpRouteCount++];
+  metrics.route = route;
+  metrics.method = method;
+  return &metrics.latency;
+}
+
+// Sabit tampona satır satır yazar; tampon dolmak üzereyken içeriği flush ile gönderir.
+struct MetricsText {
+  char *data; size_t size; size_t length; void (*flush)(const char *data, size_t length);
+  MetricsText(char *buffer, size_t bufferSize, void (*flushFn)(const char *, size_t))
+    : data(buffer), size(bufferSize), length(0), flush(flushFn) {}
+  void line(const char *format, ...) {
+    if (size - length < METRICS_LINE_MAX) finish();
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(data + length, size - length, format, args);
+    va_end(args);
+    if (written > 0) length += min((size_t)written, size - length - 1);
+  }
+  void finish() {
+    if (length > 0) flush(data, length);
+    length = 0;
+  }
+};
+
+static void writeMetricHeader(MetricsText &out, const char *name, const char *type, const char *help) {
+  out.line("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+// labels: "" ya da 'route="/set",method="POST"' biçiminde
+static void writeHistogram(MetricsText &out, const char *name, const char *labels, const Histogram &source) {
+  Histogram histogram = source; // yazarken değişmesin
+  const char *sep = labels[0] ? "," : "";
+  uint32_t cumulative = 0;
+  for (int i = 0; i < METRIC_BUCKET_COUNT; i++) {
+    cumulative += histogram.buckets[i];
+    out.line("%s_bucket{%s%sle=\"%lu\"} %lu\n", name, labels, sep, (unsigned long)METRIC_BUCKETS_US[i], (unsigned long)cumulative);
+  }
+  cumulative += histogram.buckets[METRIC_BUCKET_COUNT];
+  out.line("%s_bucket{%s%sle=\"+Inf\"} %lu\n", name, labels, sep, (unsigned long)cumulative);
+  if (labels[0]) {
+    out.line("%s_sum{%s} %llu\n%s_count{%s} %lu\n", name, labels, (unsigned long long)histogram.summary.sum,
+             name, labels, (unsigned long)cumulative);
+  } else {
+    out.line("%s_sum %llu\n%s_count %lu\n", name, (unsigned long long)histogram.summary.sum, name, (unsigned long)cumulative);
+  }
+}
+
+// Histogramı ve en büyük değerini (<ad>_max göstergesi) yazar.
+static void writeHistogramFamily(MetricsText &out, const char *name, const char *help, const Histogram &histogram) {
+  writeMetricHeader(out, name, "histogram", help);
+  writeHistogram(out, name, "", histogram);
+  out.line("# TYPE %s_max gauge\n%s_max %lu\n", name, name, (unsigned long)histogram.summary.max);
+}
+
+static void writeCounter(MetricsText &out, const char *name, const char *help, uint32_t value) {
+  writeMetricHeader(out, name, "counter", help);
+  out.line("%s %lu\n", name, (unsigned long)value);
+}
+
+static void writeGauge(MetricsText &out, const char *name, const char *help, uint32_t value) {
+  writeMetricHeader(out, name, "gauge", help);
+  out.line("%s %lu\n", name, (unsigned long)value);
+}
+
+// Tüm ölçümleri Prometheus metin biçiminde yazar.
+void writeMetrics(MetricsText &out) {
+  writeHistogramFamily(out, "kalp_engine_tick_us", "Ritim motoru tur suresi (us)", engineTickUs);
+  writeHistogramFamily(out, "kalp_edge_lateness_us", "Planlanan gecis ile islenme arasindaki gecikme (us)", edgeLatenessUs);
+
+  writeMetricHeader(out, "kalp_valve_edge_lateness_us", "summary", "Valf basina gecis gecikmesi (us)");
+  for (int i = 0; i < NUM_VALVES; i++) {
+    MetricSummary summary = valveLatenessUs[i];
+    out.line("kalp_valve_edge_lateness_us_sum{valve=\"%d\"} %llu\nkalp_valve_edge_lateness_us_count{valve=\"%d\"} %lu\n",
+             i, (unsigned long long)summary.sum, i, (unsigned long)summary.count);
+  }
+  writeMetricHeader(out, "kalp_valve_edge_lateness_us_max", "gauge", "Valf basina en buyuk gecis gecikmesi (us)");
+  for (int i = 0; i < NUM_VALVES; i++) {
+    out.line("kalp_valve_edge_lateness_us_max{valve=\"%d\"} %lu\n", i, (unsigned long)valveLatenessUs[i].max);
+  }
+
+  writeCounter(out, "kalp_solenoid_duty_calls_total", "setSolenoidDuty cagrilari", solenoidDutyCalls);
+  writeCounter(out, "kalp_solenoid_duty_changes_total", "Degeri degisen ve I2C'ye kuyruklanan gorev oranlari", solenoidDutyChanges);
+  writeCounter(out, "kalp_i2c_transactions_total", "Gonderilen I2C islemleri", i2cTransactions);
+  writeCounter(out, "kalp_i2c_channel_writes_total", "I2C islemlerinde yazilan kanal sayisi", i2cChannelWrites);
+  writeCounter(out, "kalp_i2c_errors_total", "Hatayla biten I2C islemleri", i2cErrors);
+  writeHistogramFamily(out, "kalp_i2c_latency_us", "Tek I2C isleminin suresi (us)", i2cLatencyUs);
+  writeHistogramFamily(out, "kalp_settings_write_us", "Ayar dosyasinin flash'a yazilma suresi (us)", settingsWriteUs);
+
+  writeMetricHeader(out, "kalp_http_request_us", "histogram", "HTTP istegi isleme suresi (us)");
+  for (int i = 0; i < httpRouteCount; i++) {
+    char labels[64];
+    snprintf(labels, sizeof(labels), "route=\"%s\",method=\"%s\"", httpRoutes[i].route, httpRoutes[i].method);
+    writeHistogram(out, "kalp_http_request_us", labels, httpRoutes[i].latency);
+  }
+
+  writeGauge(out, "kalp_free_heap_bytes", "Bos heap", ESP.getFreeHeap());
+  writeGauge(out, "kalp_min_free_heap_bytes", "Acilistan beri en dusuk bos heap", ESP.getMinFreeHeap());
+  writeGauge(out, "kalp_max_alloc_heap_bytes", "Ayrilabilecek en buyuk heap blogu", ESP.getMaxAllocHeap());
+  writeGauge(out, "kalp_uptime_seconds", "Acilistan beri gecen sure", (uint32_t)(esp_timer_get_time() / 1000000));
+  out.finish();
+}
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef PWM_OUTPUT_H
+#define PWM_OUTPUT_H
+
+#include <Wire.h>
+
+// PCA9685 çıkış katmanı.
+// Bir zamanlayıcı turunda yapılan tüm görev oranı değişiklikleri biriktirilir ve tur
+// sonunda tek bir I2C işlemiyle, otomatik artırmalı (auto-increment) ardışık yazma olarak
+// LEDn_ON_L..LEDn_OFF_H yazmaçlarına gönderilir. Kanal başına ayrı işlem yapılmadığı için
+// kanallar arası kenar kayması aktif valf sayısıyla büyümez.
+
+#define PCA9685_ADDRESS 0x40
+#define PCA9685_LED0_ON_L 0x06
+#define PCA9685_FULL_OFF 0x1000 // LEDn_OFF_H bit 4
+#define I2C_CLOCK_HZ 1000000    // Fast-mode Plus; PCA9685 1 MHz'e kadar destekler
+#define PWM_STAGGER_STEPS 256   // Kanal başına ON kaydırması (0 = kapalı), ani akımı yaymak için
+
+static uint16_t outputDuty[NUM_VALVES];      // her kanalın son istenen görev oranı
+static uint16_t outputOnOffset[NUM_VALVES];
+static uint16_t outputDirtyMask = 0;
+
+void setupPwmOutput() {
+  // pwm.begin() Wire'ı başlatır; setPWMFreq() MODE1'de otomatik artırmayı açar.
+  Wire.setClock(I2C_CLOCK_HZ);
+  for (int i = 0; i < NUM_VALVES; i++) {
+    outputDuty[i] = 0;
+    outputOnOffset[i] = (i * PWM_STAGGER_STEPS) & 0x0FFF;
+  }
+  outputDirtyMask = 0;
+}
+
+// Değişikliği yalnızca kaydeder; donanıma flushPwmOutput() ile gider.
+void queuePwmOutput(uint8_t channel, uint16_t dutyCycle) {
+  outputDuty[channel] = dutyCycle;
+  outputDirtyMask |= (uint16_t)(1u << channel);
+}
+
+// Değişen ilk ve son kanal arasındaki tüm kanalları tek işlemde yazar.
+// Aradaki değişmemiş kanallar aynı değerle yeniden yazılır; ayrı işlem açmaktan ucuzdur.
+// İşlemin bittiği zamanı, yazılacak değişiklik yoksa 0 döner.
+uint64_t flushPwmOutput() {
+  if (outputDirtyMask == 0) return 0;
+  int first = __builtin_ctz(outputDirtyMask);
+  int last = 31 - __builtin_clz(outputDirtyMask);
+
+  uint64_t start = esp_timer_get_time();
+  Wire.beginTransmission(PCA9685_ADDRESS);
+  Wire.write(PCA9685_LED0_ON_L + 4 * first);
+  for (int ch = first; ch <= last; ch++) {
+    uint16_t on, off;
+    if (outputDuty[ch] == 0) {
+      on = 0; off = PCA9685_FULL_OFF;
+    } else {
+      on = outputOnOffset[ch];
+      off = (on + outputDuty[ch]) & 0x0FFF;
+    }
+    uint8_t regs[4] = { (uint8_t)on, (uint8_t)(on >> 8), (uint8_t)off, (uint8_t)(off >> 8) };
+    Wire.write(regs, sizeof(regs));
+  }
+  if (Wire.endTransmission() != 0) i2cErrors++;
+  uint64_t done = esp_timer_get_time();
+  observeHistogram(i2cLatencyUs, (uint32_t)(done - start));
+  i2cTransactions++;
+  i2cChannelWrites += last - first + 1;
+  outputDirtyMask = 0;
+  return done;
+}
+
+#endif
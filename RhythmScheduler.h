@@ -0,0 +1,477 @@
+#ifndef RHYTHM_SCHEDULER_H
+#define RHYTHM_SCHEDULER_H
+
+#include <esp_timer.h>
+#include "CommandQueue.h"
+
+// Olay tabanlı ritim zamanlayıcısı.
+// Her valfin bir sonraki geçiş zamanı (nextEventTime, µs) bir min-heap'te tutulur.
+// Heap'in başındaki valf için tek seferlik bir esp_timer kurulur; zamanı gelince
+// zamanlayıcı görevi uyandırır ve yalnızca zamanı gelmiş olaylar işlenir.
+//
+// Atışlar ortak bir ritim saatine kilitlidir: valfin k. atışı
+// rhythmEpoch + pulseDelay + k * beatInterval anındadır. Böylece aynı nabızdaki valfler
+// hiçbir zaman birbirinden kaymaz, aralarında yalnızca nabız geçiş gecikmesi kalır.
+//
+// Ritim motoru RHYTHM_CORE çekirdeğine sabitlenmiş kendi görevinde çalışır ve valves[]
+// dizisinin tek sahibidir. Web tarafı ayar değişikliklerini SPSC komut kuyruğuyla gönderir,
+// durumu ise çift tamponlu anlık görüntüden (readValveStatus) okur.
+
+#define RHYTHM_CORE 1
+#define RHYTHM_TASK_PRIORITY 10
+#define RHYTHM_TASK_STACK 4096
+#define COMMAND_QUEUE_SIZE 128
+#define BEAT_EVENT_QUEUE_SIZE 64
+
+// .ino dosyasındaki fonksiyonlar
+extern bool handleHeartRhythm(int valveIndex, uint64_t currentTime);
+
+static uint8_t rhythmHeap[NUM_VALVES];   // valf indeksleri, nextEventTime'a göre sıralı
+static int8_t rhythmHeapSlot[NUM_VALVES]; // valfin heap içindeki yeri, yoksa -1
+static uint8_t rhythmHeapSize = 0;
+
+static esp_timer_handle_t rhythmTimer = NULL;
+static TaskHandle_t rhythmTaskHandle = NULL;
+static uint64_t rhythmArmedDeadline = 0;
+static uint64_t rhythmEpoch = 0; // ortak ritim saatinin başlangıcı (µs)
+
+static SpscQueue<ValveCommand, COMMAND_QUEUE_SIZE> valveCommands;
+static uint32_t valveCommandsPushed = 0;                 // yalnızca web tarafı yazar
+static std::atomic<uint32_t> valveCommandsApplied{0};    // yalnızca motor yazar
+
+// Motordan web tarafına atış olayları; kuyruk doluysa olay düşürülür, motor beklemez.
+enum BeatPhase : uint8_t { BEAT_START, BEAT_END };
+struct BeatEvent {
+  uint8_t valve; BeatPhase phase; uint32_t timeMs;
+};
+static SpscQueue<BeatEvent, BEAT_EVENT_QUEUE_SIZE> beatEvents;
+
+// Toplu güncelleme: BEGIN_BULK sonrası komutlar stagedValves'e yazılır (yalnızca motor).
+static ValveControl stagedValves[NUM_VALVES];
+static uint16_t bulkValveMask = 0;    // toplu güncellemedeki valfler
+static uint16_t bulkRestartMask = 0;  // atışı baştan başlatılacak valfler
+static bool bulkStaging = false;      // BEGIN_BULK alındı, COMMIT_BULK bekleniyor
+static bool bulkBoundaryReached = false; // kalan valfler kendi atışlarının sonunda geçer
+static std::atomic<bool> bulkUpdatePending{false}; // onaylandı, atış sınırı bekleniyor
+
+// Bu turda işlenen kenarların planlanan zamanı; gecikme, kenarı taşıyan I2C işlemi
+// bittiğinde ölçülür. Valfin aynı turdaki önceki kenarları tek yazmada birleşir,
+// yalnızca sonuncusu hatta çıkar.
+static uint64_t edgePlannedTime[NUM_VALVES];
+static uint16_t edgePendingMask = 0;
+static void applyBulkAtBoundary();
+static void applyStagedValve(uint8_t valveIndex, uint64_t from);
+static void publishValveStatus();
+static void copyValveSettings(ValveControl &valve, const ValveControl &staged);
+
+// Durum anlık görüntüsü: motor statusSeq+1 numaralı tampona yazar, sonra statusSeq'i artırır.
+static ValveControl statusBuffers[2][NUM_VALVES];
+static std::atomic<uint32_t> statusSeq{0};
+
+uint64_t rhythmNowMicros() {
+  return (uint64_t)esp_timer_get_time();
+}
+
+// Valfin ritim saati ızgarasındaki, after anından önce olmayan ilk atış zamanı.
+uint64_t nextBeatTime(const ValveControl &valve, uint64_t after) {
+  uint64_t origin = rhythmEpoch + valve.pulseDelay * 1000ULL;
+  if (after <= origin) return origin;
+  uint64_t beats = (after - origin + valve.beatInterval - 1) / valve.beatInterval;
+  return origin + beats * valve.beatInterval;
+}
+
+static bool rhythmHeapLess(uint8_t a, uint8_t b) {
+  return valves[rhythmHeap[a]].nextEventTime < valves[rhythmHeap[b]].nextEventTime;
+}
+
+static void rhythmHeapSwap(uint8_t a, uint8_t b) {
+  uint8_t tmp = rhythmHeap[a]; rhythmHeap[a] = rhythmHeap[b]; rhythmHeap[b] = tmp;
+  rhythmHeapSlot[rhythmHeap[a]] = a; rhythmHeapSlot[rhythmHeap[b]] = b;
+}
+
+static void rhythmHeapSiftUp(uint8_t slot) {
+  while (slot > 0) {
+    uint8_t parent = (slot - 1) / 2;
+    if (!rhythmHeapLess(slot, parent)) break;
+    rhythmHeapSwap(slot, parent);
+    slot = parent;
+  }
+}
+
+static void rhythmHeapSiftDown(uint8_t slot) {
+  for (;;) {
+    uint8_t left = 2 * slot + 1, right = left + 1, smallest = slot;
+    if (left < rhythmHeapSize && rhythmHeapLess(left, smallest)) smallest = left;
+    if (right < rhythmHeapSize && rhythmHeapLess(right, smallest)) smallest = right;
+    if (smallest == slot) break;
+    rhythmHeapSwap(slot, smallest);
+    slot = smallest;
+  }
+}
+
+// Valfi heap'e ekler ya da nextEventTime değiştiyse yerini düzeltir.
+static void rhythmHeapUpdate(uint8_t valveIndex) {
+  int8_t slot = rhythmHeapSlot[valveIndex];
+  if (slot < 0) {
+    slot = rhythmHeapSize++;
+    rhythmHeap[slot] = valveIndex;
+    rhythmHeapSlot[valveIndex] = slot;
+  }
+  rhythmHeapSiftUp(slot);
+  rhythmHeapSiftDown(rhythmHeapSlot[valveIndex]);
+}
+
+static void rhythmHeapRemove(uint8_t valveIndex) {
+  int8_t slot = rhythmHeapSlot[valveIndex];
+  if (slot < 0) return;
+  uint8_t last = --rhythmHeapSize;
+  if (slot != last) {
+    rhythmHeapSwap(slot, last);
+    rhythmHeapSlot[valveIndex] = -1;
+    rhythmHeapSiftUp(slot);
+    rhythmHeapSiftDown(slot);
+  } else {
+    rhythmHeapSlot[valveIndex] = -1;
+  }
+}
+
+static void onRhythmTimer(void *arg) {
+  if (rhythmTaskHandle != NULL) xTaskNotifyGive(rhythmTaskHandle);
+}
+
+static void armRhythmTimer(uint64_t deadline, uint64_t now) {
+  if (deadline == rhythmArmedDeadline) return;
+  esp_timer_stop(rhythmTimer); // çalışmıyorsa hata döner, önemsiz
+  esp_timer_start_once(rhythmTimer, deadline > now ? deadline - now : 1);
+  rhythmArmedDeadline = deadline;
+}
+
+void setupRhythmScheduler() {
+  // Ayar komutları kanal ve çıkış önbelleğine dokunmaz; motorun kopyası burada bir kez kurulur.
+  for (int i = 0; i < NUM_VALVES; i++) {
+    valves[i].channel = i;
+    valves[i].lastDutyCycle = -1;
+    rhythmHeapSlot[i] = -1;
+  }
+  rhythmHeapSize = 0;
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = onRhythmTimer;
+  timerArgs.dispatch_method = ESP_TIMER_TASK;
+  timerArgs.name = "ritim";
+  esp_timer_create(&timerArgs, &rhythmTimer);
+  rhythmEpoch = rhythmNowMicros();
+}
+
+// Valfin ayarları değiştiğinde çağrılır.
+// restart: mod, açık/kapalı ya da ritim tipi değiştiyse atış baştan başlatılır.
+// Yeni atış hemen değil, ritim saatinin from anından sonraki ilk ızgara noktasında başlar.
+static void rescheduleValveFrom(int valveIndex, bool restart, uint64_t from) {
+  ValveControl &valve = valves[valveIndex];
+  bool active = valve.state && valve.mode == HEART_RHYTHM;
+  bool idle = !valve.isPulsing;
+
+  if (restart || !active) {
+    if (!idle) setSolenoidDuty(valve.channel, 0);
+    valve.isPulsing = false;
+    idle = true;
+  }
+  if (!active) {
+    rhythmHeapRemove(valveIndex);
+    return;
+  }
+  if (restart || idle || rhythmHeapSlot[valveIndex] < 0) {
+    // Atışlar arası beklemede: yeni nabız aralığı ve gecikme hemen geçerli olsun
+    valve.nextEventTime = nextBeatTime(valve, from);
+  }
+  rhythmHeapUpdate(valveIndex);
+}
+
+void rescheduleValve(int valveIndex, bool restart) {
+  rescheduleValveFrom(valveIndex, restart, rhythmNowMicros());
+}
+
+// Zamanı gelmiş tüm olayları işler ve zamanlayıcıyı bir sonraki olaya kurar.
+// Bir sonraki olayın zamanını, zamanlanmış valf yoksa 0 döner.
+uint64_t runRhythmScheduler() {
+  uint64_t now = rhythmNowMicros();
+  while (rhythmHeapSize > 0) {
+    uint8_t valveIndex = rhythmHeap[0];
+    if (valves[valveIndex].nextEventTime > now) break;
+    bool bulkValve = bulkUpdatePending.load(std::memory_order_relaxed) && (bulkValveMask & (1u << valveIndex));
+    if (bulkValve && !bulkBoundaryReached && !valves[valveIndex].isPulsing) {
+      applyBulkAtBoundary(); // atış sınırı: toplu değişiklikler birlikte devreye girer
+      continue;
+    }
+    edgePlannedTime[valveIndex] = valves[valveIndex].nextEventTime;
+    edgePendingMask |= (uint16_t)(1u << valveIndex);
+    if (handleHeartRhythm(valveIndex, now)) {
+      rhythmHeapSiftDown(0);
+      if (bulkValve && !valves[valveIndex].isPulsing) {
+        applyStagedValve(valveIndex, now); // sınırda atışın ortasındaydı, atış şimdi bitti
+        publishValveStatus();
+      }
+    } else {
+      rhythmHeapRemove(valveIndex);
+    }
+  }
+  if (rhythmHeapSize == 0) return 0;
+  uint64_t nextDeadline = valves[rhythmHeap[0]].nextEventTime;
+  armRhythmTimer(nextDeadline, now);
+  return nextDeadline;
+}
+
+void publishBeatEvent(uint8_t valveIndex, BeatPhase phase, uint64_t time) {
+  BeatEvent event = { valveIndex, phase, (uint32_t)(time / 1000) };
+  beatEvents.push(event);
+}
+
+// Onaylanmış ama atış sınırını bekleyen toplu güncellemenin ayarları görüntüye işlenir;
+// böylece web tarafı (kaydetme, dışa aktarma, /status) sınırı beklemeden yeni ayarları okur.
+static void publishValveStatus() {
+  uint32_t seq = statusSeq.load(std::memory_order_relaxed) + 1;
+  ValveControl *status = statusBuffers[seq & 1];
+  memcpy(status, valves, sizeof(valves));
+  if (bulkUpdatePending.load(std::memory_order_relaxed) && !bulkStaging) {
+    for (uint8_t i = 0; i < NUM_VALVES; i++) {
+      if (bulkValveMask & (1u << i)) copyValveSettings(status[i], stagedValves[i]);
+    }
+  }
+  statusSeq.store(seq, std::memory_order_release);
+}
+
+// Web tarafı: motoru bekletmeden son yayımlanan durumu kopyalar.
+// Kopyalama sırasında yeni bir görüntü yayımlandıysa tekrar dener.
+void readValveStatus(ValveControl *out) {
+  for (;;) {
+    uint32_t seq = statusSeq.load(std::memory_order_acquire);
+    memcpy(out, statusBuffers[seq & 1], sizeof(valves));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (statusSeq.load(std::memory_order_relaxed) == seq) return;
+  }
+}
+
+// Ayar değişikliklerini devreye alır: tabloyu derler, atışı yeniden zamanlar ve
+// manuel/kapalı valflerin çıkışını günceller.
+static void applyValveChanges(uint8_t valveIndex, bool restart, uint64_t from) {
+  ValveControl &valve = valves[valveIndex];
+  compileValveWaveform(valveIndex); // tablo yalnızca ayar değiştiğinde yeniden kurulur
+  rescheduleValveFrom(valveIndex, restart, from);
+  if (valve.state && valve.mode == MANUAL_PWM) {
+    setSolenoidDuty(valve.channel, valve.pwmValue);
+  } else if (!valve.state) {
+    setSolenoidDuty(valve.channel, 0);
+  }
+}
+
+// Toplu güncellemede yalnızca ayarlar kopyalanır; çalışma zamanı alanları (kanal, atış
+// zamanı, tablo konumu vb.) korunur.
+static void copyValveSettings(ValveControl &valve, const ValveControl &staged) {
+  valve.state = staged.state; valve.mode = staged.mode; valve.pwmValue = staged.pwmValue;
+  valve.heartRate = staged.heartRate; valve.beatInterval = staged.beatInterval;
+  valve.useDynamicPulse = staged.useDynamicPulse; valve.manualPulseDuration = staged.manualPulseDuration;
+  valve.usePQRST = staged.usePQRST; valve.pWaveDuration = staged.pWaveDuration;
+  valve.prSegmentDuration = staged.prSegmentDuration; valve.rWaveDuration = staged.rWaveDuration;
+  valve.stSegmentDuration = staged.stSegmentDuration; valve.tWaveDuration = staged.tWaveDuration;
+  valve.pWavePwm = staged.pWavePwm; valve.rWavePwm = staged.rWavePwm; valve.tWavePwm = staged.tWavePwm;
+  valve.waveShape = staged.waveShape; valve.pulseDelay = staged.pulseDelay;
+}
+
+// Bekleyen toplu güncellemeden bir valfi devreye alır; from: yeni ızgarada aranacak ilk atış anı.
+static void applyStagedValve(uint8_t valveIndex, uint64_t from) {
+  uint16_t bit = 1u << valveIndex;
+  copyValveSettings(valves[valveIndex], stagedValves[valveIndex]);
+  applyValveChanges(valveIndex, bulkRestartMask & bit, from);
+  bulkValveMask &= ~bit;
+  bulkRestartMask &= ~bit;
+  if (bulkValveMask == 0) {
+    bulkBoundaryReached = false;
+    bulkUpdatePending.store(false, std::memory_order_release);
+  }
+}
+
+// Etkilenen valflerden birinin atışı başlamak üzere. Atışlar arasındaki valfler yeni
+// ayarlara hemen geçer; zamanı gelmiş atışın planlanan zamanından aranır, böylece
+// tetikleyen valfin bu atışı atlanmaz, yeni ayarlarla çalınır. Atışın ortasındaki
+// valfler atışı eski tabloyla bitirir ve kendi BEAT_END'lerinde geçer.
+static void applyBulkAtBoundary() {
+  uint64_t now = rhythmNowMicros();
+  bulkBoundaryReached = true;
+  for (uint8_t i = 0; i < NUM_VALVES; i++) {
+    if (!(bulkValveMask & (1u << i)) || valves[i].isPulsing) continue;
+    applyStagedValve(i, rhythmHeapSlot[i] >= 0 ? min(now, valves[i].nextEventTime) : now);
+  }
+  publishValveStatus();
+}
+
+// Sırayı korumak için bekleyen toplu güncellemenin tamamını sınırı beklemeden uygular.
+static void applyBulkNow() {
+  uint64_t now = rhythmNowMicros();
+  for (uint8_t i = 0; i < NUM_VALVES; i++) {
+    if (bulkValveMask & (1u << i)) applyStagedValve(i, now);
+  }
+  publishValveStatus();
+}
+
+// COMMIT_BULK: etkilenen valflerden ritimde çalışan yoksa beklenecek atış sınırı da
+// yoktur, güncelleme hemen uygulanır.
+static void commitBulkUpdate() {
+  bulkStaging = false;
+  if (bulkValveMask == 0) return;
+  bulkUpdatePending.store(true, std::memory_order_relaxed);
+  for (uint8_t i = 0; i < NUM_VALVES; i++) {
+    if ((bulkValveMask & (1u << i)) && rhythmHeapSlot[i] >= 0) return;
+  }
+  applyBulkNow();
+}
+
+static void applyValveCommand(const ValveCommand &cmd) {
+  // Toplu güncelleme beklerken gelen diğer komutlar sırayı bozmasın diye önce onu uygula
+  if (bulkUpdatePending.load(std::memory_order_relaxed) && !bulkStaging) applyBulkNow();
+  if (cmd.type == BEGIN_BULK) { bulkStaging = true; return; }
+  if (cmd.type == COMMIT_BULK) { commitBulkUpdate(); return; }
+
+  bool staged = bulkStaging && cmd.type <= SET_PULSE_DELAY;
+  if (staged && !(bulkValveMask & (1u << cmd.valve))) {
+    stagedValves[cmd.valve] = valves[cmd.valve];
+    bulkValveMask |= (1u << cmd.valve);
+  }
+  // /set, /bulk, /waveform, dosya ve JSON içe aktarma buradan geçer; aralık denetimi
+  // yalnızca burada yapılır.
+  ValveControl &valve = staged ? stagedValves[cmd.valve] : valves[cmd.valve];
+  switch (cmd.type) {
+    case SET_STATE: valve.state = cmd.value != 0; break;
+    case SET_MODE: valve.mode = cmd.value == HEART_RHYTHM ? HEART_RHYTHM : MANUAL_PWM; break;
+    case SET_PWM_VALUE: valve.pwmValue = constrain(cmd.value, 0, 4095); break;
+    case SET_HEART_RATE: valve.heartRate = constrain(cmd.value, MIN_BPM, MAX_BPM); valve.beatInterval = bpmToInterval(valve.heartRate); break;
+    case SET_DYNAMIC_PULSE: valve.useDynamicPulse = cmd.value != 0; break;
+    case SET_MANUAL_PULSE_DURATION: valve.manualPulseDuration = constrain(cmd.value, MIN_PULSE_DURATION_MS, MAX_SEGMENT_DURATION_MS); break;
+    case SET_USE_PQRST: valve.usePQRST = cmd.value != 0; break;
+    case SET_P_WAVE_DURATION: valve.pWaveDuration = constrain(cmd.value, 0, MAX_SEGMENT_DURATION_MS); break;
+    case SET_PR_SEGMENT_DURATION: valve.prSegmentDuration = constrain(cmd.value, 0, MAX_SEGMENT_DURATION_MS); break;
+    case SET_R_WAVE_DURATION: valve.rWaveDuration = constrain(cmd.value, 0, MAX_SEGMENT_DURATION_MS); break;
+    case SET_ST_SEGMENT_DURATION: valve.stSegmentDuration = constrain(cmd.value, 0, MAX_SEGMENT_DURATION_MS); break;
+    case SET_T_WAVE_DURATION: valve.tWaveDuration = constrain(cmd.value, 0, MAX_SEGMENT_DURATION_MS); break;
+    case SET_P_WAVE_PWM: valve.pWavePwm = constrain(cmd.value, 0, 100); break;
+    case SET_R_WAVE_PWM: valve.rWavePwm = constrain(cmd.value, 0, 100); break;
+    case SET_T_WAVE_PWM: valve.tWavePwm = constrain(cmd.value, 0, 100); break;
+    case SET_WAVE_SHAPE: valve.waveShape = cmd.value >= WAVE_SQUARE && cmd.value <= WAVE_CUSTOM ? (WaveShape)cmd.value : WAVE_SQUARE; break;
+    case SET_PULSE_DELAY: valve.pulseDelay = constrain(cmd.value, 0, MAX_PULSE_DELAY_MS); break;
+    case SET_CUSTOM_WAVE_LENGTH:
+      customWaves[cmd.valve].length = min(cmd.value & 0xFF, CUSTOM_WAVE_MAX_SAMPLES);
+      customWaves[cmd.valve].sampleMs = max((cmd.value >> 8) & 0xFF, 1);
+      break;
+    case SET_CUSTOM_WAVE_SAMPLE:
+      if (((cmd.value >> 8) & 0xFF) < CUSTOM_WAVE_MAX_SAMPLES) customWaves[cmd.valve].levels[(cmd.value >> 8) & 0xFF] = min(cmd.value & 0xFF, 100);
+      break;
+    case APPLY_VALVE:
+      if (bulkStaging) {
+        if (cmd.value != 0) bulkRestartMask |= (1u << cmd.valve);
+      } else {
+        applyValveChanges(cmd.valve, cmd.value != 0, rhythmNowMicros());
+      }
+      break;
+    default: break;
+  }
+}
+
+// Motor tarafı: olaylar arasındaki güvenli noktada bekleyen tüm komutları uygular.
+static void applyValveCommands() {
+  ValveCommand cmd;
+  uint32_t applied = 0;
+  while (valveCommands.pop(cmd)) {
+    applyValveCommand(cmd);
+    applied++;
+  }
+  if (applied > 0) {
+    publishValveStatus();
+    valveCommandsApplied.fetch_add(applied, std::memory_order_release);
+  }
+}
+
+// Web tarafı: komutu kuyruğa koyar. Kuyruk doluysa yalnızca web görevi bekler.
+// Motor henüz başlatılmadıysa (açılışta) komut hemen uygulanır.
+void pushValveCommand(uint8_t valveIndex, ValveCommandType type, int32_t value) {
+  ValveCommand cmd = { valveIndex, type, value };
+  while (!valveCommands.push(cmd)) {
+    xTaskNotifyGive(rhythmTaskHandle);
+    vTaskDelay(1);
+  }
+  valveCommandsPushed++;
+  if (rhythmTaskHandle != NULL) {
+    xTaskNotifyGive(rhythmTaskHandle);
+  } else {
+    applyValveCommands();
+  }
+}
+
+// Bir valfin tüm ayarlarını gönderir ve atışı baştan başlatır.
+void submitValveSettings(int valveIndex, const ValveControl &settings) {
+  pushValveCommand(valveIndex, SET_STATE, settings.state);
+  pushValveCommand(valveIndex, SET_MODE, settings.mode);
+  pushValveCommand(valveIndex, SET_PWM_VALUE, settings.pwmValue);
+  pushValveCommand(valveIndex, SET_HEART_RATE, settings.heartRate);
+  pushValveCommand(valveIndex, SET_DYNAMIC_PULSE, settings.useDynamicPulse);
+  pushValveCommand(valveIndex, SET_MANUAL_PULSE_DURATION, settings.manualPulseDuration);
+  pushValveCommand(valveIndex, SET_USE_PQRST, settings.usePQRST);
+  pushValveCommand(valveIndex, SET_P_WAVE_DURATION, settings.pWaveDuration);
+  pushValveCommand(valveIndex, SET_PR_SEGMENT_DURATION, settings.prSegmentDuration);
+  pushValveCommand(valveIndex, SET_R_WAVE_DURATION, settings.rWaveDuration);
+  pushValveCommand(valveIndex, SET_ST_SEGMENT_DURATION, settings.stSegmentDuration);
+  pushValveCommand(valveIndex, SET_T_WAVE_DURATION, settings.tWaveDuration);
+  pushValveCommand(valveIndex, SET_P_WAVE_PWM, settings.pWavePwm);
+  pushValveCommand(valveIndex, SET_R_WAVE_PWM, settings.rWavePwm);
+  pushValveCommand(valveIndex, SET_T_WAVE_PWM, settings.tWavePwm);
+  pushValveCommand(valveIndex, SET_WAVE_SHAPE, settings.waveShape);
+  pushValveCommand(valveIndex, SET_PULSE_DELAY, settings.pulseDelay);
+  pushValveCommand(valveIndex, APPLY_VALVE, 1);
+}
+
+// Özel dalga örneklerini motora gönderir ve web tarafı kopyasını günceller.
+// Devreye alınması için ardından APPLY_VALVE gönderilmelidir.
+void submitCustomWave(int valveIndex, const CustomWave &wave) {
+  uploadedWaves[valveIndex] = wave;
+  pushValveCommand(valveIndex, SET_CUSTOM_WAVE_LENGTH, (wave.sampleMs << 8) | wave.length);
+  for (int i = 0; i < wave.length; i++) {
+    pushValveCommand(valveIndex, SET_CUSTOM_WAVE_SAMPLE, (i << 8) | wave.levels[i]);
+  }
+}
+
+// Web tarafı: gönderilen tüm komutlar uygulanıp durum yayımlanana kadar bekler.
+// Atış sınırını bekleyen toplu güncelleme beklenmez; yayımlanan durum onun ayarlarını içerir.
+void waitForValveCommands() {
+  while (valveCommandsApplied.load(std::memory_order_acquire) != valveCommandsPushed) {
+    vTaskDelay(1);
+  }
+}
+
+// Motorun tek bir turu: komutlar, zamanı gelmiş olaylar ve toplu I2C yazımı.
+// Görevden bağımsız olduğu için motor, saati ve Wire'ı taklit eden bir ortamda
+// (ör. bilgisayarda sanal saatle) dönen zamana atlanarak adım adım sürülebilir.
+uint64_t runRhythmEngineOnce() {
+  uint64_t start = rhythmNowMicros();
+  applyValveCommands();
+  uint64_t nextDeadline = runRhythmScheduler();
+  uint64_t flushedAt = flushPwmOutput(); // bu turdaki tüm değişiklikler tek I2C işleminde
+  if (flushedAt == 0) flushedAt = rhythmNowMicros();
+  for (uint16_t pending = edgePendingMask; pending != 0; pending &= pending - 1) {
+    int valveIndex = __builtin_ctz(pending);
+    recordEdgeLateness(valveIndex, (uint32_t)(flushedAt - edgePlannedTime[valveIndex]));
+  }
+  edgePendingMask = 0;
+  observeHistogram(engineTickUs, metricsElapsedUs(start));
+  return nextDeadline;
+}
+
+static void rhythmEngineTask(void *arg) {
+  for (;;) {
+    runRhythmEngineOnce();
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+
+void startRhythmEngine() {
+  publishValveStatus();
+  xTaskCreatePinnedToCore(rhythmEngineTask, "ritim", RHYTHM_TASK_STACK, NULL, RHYTHM_TASK_PRIORITY, &rhythmTaskHandle, RHYTHM_CORE);
+}
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+// Sürümlü ikili ayar kaydı.
+// Dosya: SettingsHeader + NUM_VALVES adet sabit boyutlu StoredValve. Kayıtlar CRC-32 ile
+// korunur; dosya önce geçici adla yazılıp sonra yeniden adlandırıldığından yazma sırasında
+// güç kesilse de eski ya da yeni dosyadan biri sağlam kalır.
+// Web tarafı dosyanın bellekteki kopyasını (storedValves) tutar; kaydederken yalnızca
+// değişmiş (dirty) valflerin kaydı yeniden kodlanır. /set sonrası kayıt, ayar akışı
+// durduktan AUTOSAVE_DELAY_MS sonra tek seferde yapılır.
+
+#define SETTINGS_FILE "/settings.bin"
+#define SETTINGS_TEMP_FILE "/settings.tmp"
+#define SETTINGS_MAGIC 0x4D54524BUL // "KRTM"
+#define SETTINGS_VERSION 1
+#define AUTOSAVE_DELAY_MS 2000
+
+struct __attribute__((packed)) StoredValve {
+  uint8_t state, mode, useDynamicPulse, usePQRST, waveShape, customLength, customSampleMs, reserved;
+  uint16_t pwmValue, heartRate, manualPulseDuration;
+  uint16_t pWaveDuration, prSegmentDuration, rWaveDuration, stSegmentDuration, tWaveDuration;
+  uint8_t pWavePwm, rWavePwm, tWavePwm, reserved2;
+  uint8_t customLevels[CUSTOM_WAVE_MAX_SAMPLES];
+  uint16_t pulseDelay;
+};
+
+struct __attribute__((packed)) SettingsHeader {
+  uint32_t magic; uint16_t version; uint8_t valveCount; uint8_t reserved; uint16_t recordSize; uint16_t reserved2; uint32_t crc;
+};
+
+static StoredValve storedValves[NUM_VALVES]; // yalnızca web görevi kullanır
+static uint16_t settingsDirtyMask = 0;
+static bool settingsSavePending = false;
+static unsigned long settingsLastChange = 0;
+
+// crc önceki parçanın sonucudur; parça parça hesaplanabilir.
+uint32_t settingsCrc32(const uint8_t *data, size_t length, uint32_t crc = 0) {
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+void encodeStoredValve(StoredValve &record, const ValveControl &valve, const CustomWave &wave) {
+  memset(&record, 0, sizeof(record));
+  record.state = valve.state; record.mode = valve.mode; record.useDynamicPulse = valve.useDynamicPulse;
+  record.usePQRST = valve.usePQRST; record.waveShape = valve.waveShape;
+  record.pwmValue = valve.pwmValue; record.heartRate = valve.heartRate; record.manualPulseDuration = valve.manualPulseDuration;
+  record.pWaveDuration = valve.pWaveDuration; record.prSegmentDuration = valve.prSegmentDuration;
+  record.rWaveDuration = valve.rWaveDuration; record.stSegmentDuration = valve.stSegmentDuration;
+  record.tWaveDuration = valve.tWaveDuration;
+  record.pWavePwm = valve.pWavePwm; record.rWavePwm = valve.rWavePwm; record.tWavePwm = valve.tWavePwm;
+  record.pulseDelay = valve.pulseDelay;
+  record.customLength = wave.length; record.customSampleMs = wave.sampleMs;
+  memcpy(record.customLevels, wave.levels, wave.length);
+}
+
+void decodeStoredValve(const StoredValve &record, int valveIndex, ValveControl &valve, CustomWave &wave) {
+  valve = defaultValveSettings(valveIndex);
+  valve.state = record.state != 0; valve.mode = (ControlMode)record.mode; valve.useDynamicPulse = record.useDynamicPulse != 0;
+  valve.usePQRST = record.usePQRST != 0; valve.waveShape = (WaveShape)record.waveShape;
+  valve.pwmValue = record.pwmValue; valve.heartRate = record.heartRate; valve.manualPulseDuration = record.manualPulseDuration;
+  valve.pWaveDuration = record.pWaveDuration; valve.prSegmentDuration = record.prSegmentDuration;
+  valve.rWaveDuration = record.rWaveDuration; valve.stSegmentDuration = record.stSegmentDuration;
+  valve.tWaveDuration = record.tWaveDuration;
+  valve.pWavePwm = record.pWavePwm; valve.rWavePwm = record.rWavePwm; valve.tWavePwm = record.tWavePwm;
+  valve.pulseDelay = record.pulseDelay;
+  // Aralık denetimi motorda (applyValveCommand) yapılır; burada yalnızca tampon sınırı korunur
+  wave = {};
+  wave.length = min((int)record.customLength, CUSTOM_WAVE_MAX_SAMPLES); wave.sampleMs = record.customSampleMs;
+  memcpy(wave.levels, record.customLevels, wave.length);
+}
+
+// storedValves'i geçici dosyaya yazar ve asıl dosyanın yerine koyar.
+bool writeSettingsFile() {
+  SettingsHeader header = {};
+  header.magic = SETTINGS_MAGIC; header.version = SETTINGS_VERSION;
+  header.valveCount = NUM_VALVES; header.recordSize = sizeof(StoredValve);
+  header.crc = settingsCrc32((const uint8_t *)storedValves, sizeof(storedValves));
+
+  uint64_t start = esp_timer_get_time();
+  File file = LittleFS.open(SETTINGS_TEMP_FILE, "w");
+  if (!file) return false;
+  bool ok = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            file.write((const uint8_t *)storedValves, sizeof(storedValves)) == sizeof(storedValves);
+  file.close();
+  if (!ok) {
+    LittleFS.remove(SETTINGS_TEMP_FILE);
+    return false;
+  }
+  ok = LittleFS.rename(SETTINGS_TEMP_FILE, SETTINGS_FILE);
+  observeHistogram(settingsWriteUs, metricsElapsedUs(start));
+  return ok;
+}
+
+// Dosyayı storedValves'e okur; başlık, sürüm, boyut ya da CRC tutmazsa false döner.
+bool readSettingsFile() {
+  File file = LittleFS.open(SETTINGS_FILE, "r");
+  if (!file) return false;
+  SettingsHeader header;
+  bool ok = file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == SETTINGS_MAGIC && header.valveCount == NUM_VALVES &&
+            header.version == SETTINGS_VERSION && header.recordSize == sizeof(StoredValve);
+  uint32_t crc = 0;
+  for (int i = 0; ok && i < NUM_VALVES; i++) {
+    ok = file.read((uint8_t *)&storedValves[i], sizeof(StoredValve)) == sizeof(StoredValve);
+    crc = settingsCrc32((const uint8_t *)&storedValves[i], sizeof(StoredValve), crc);
+  }
+  file.close();
+  if (!ok || crc != header.crc) return false;
+  settingsDirtyMask = 0;
+  settingsSavePending = false;
+  settingsLastChange = millis();
+  return true;
+}
+
+// Web tarafı: valfin ayarı değişti, kısa süre başka değişiklik gelmezse kaydedilecek.
+void markSettingsDirty(int valveIndex) {
+  settingsDirtyMask |= (uint16_t)(1u << valveIndex);
+  settingsSavePending = true;
+  settingsLastChange = millis();
+}
+
+void markAllSettingsDirty() {
+  for (int i = 0; i < NUM_VALVES; i++) markSettingsDirty(i);
+}
+
+// Web görevinin her turunda çağrılır; değişiklik akışı durunca bir kez kaydeder.
+void pollSettingsAutosave() {
+  if (settingsSavePending && millis() - settingsLastChange >= AUTOSAVE_DELAY_MS) {
+    saveSettings();
+  }
+}
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef STATUS_STREAM_H
+#define STATUS_STREAM_H
+
+#include <stdarg.h>
+
+// Canlı durum akışı (Server-Sent Events, /events).
+// Web görevi STREAM_INTERVAL_MS aralıklarla ritim motorunun anlık görüntüsünü son
+// gönderilenle karşılaştırır ve yalnızca değişen valf/alanları, biriken atış olaylarıyla
+// birlikte bir kez seri hale getirip aynı tamponu tüm abonelere yazar.
+// JSON, yığında belge kurmadan önceden ayrılmış sabit tamponlara yazılır.
+
+#define MAX_STREAM_CLIENTS 4
+#define STREAM_INTERVAL_MS 50
+#define STREAM_KEEPALIVE_MS 15000
+#define JSON_BUFFER_SIZE 8192 // /status, /events ve akış aynı (web görevi) tamponu kullanır
+#define BEAT_EVENT_JSON_MAX 64
+
+// Sabit boyutlu tampona JSON yazıcı; taşarsa overflow işaretlenir, yazma durur.
+struct JsonBuffer {
+  char *data; size_t size; size_t length; bool overflow;
+  JsonBuffer(char *buffer, size_t bufferSize) : data(buffer), size(bufferSize), length(0), overflow(false) { data[0] = '\0'; }
+  void append(const char *format, ...) {
+    if (overflow) return;
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(data + length, size - length, format, args);
+    va_end(args);
+    if (written < 0 || (size_t)written >= size - length) { overflow = true; data[length] = '\0'; return; }
+    length += written;
+  }
+};
+
+// Durum alanları komut türleriyle aynı sırada; /set anahtarlarıyla aynı adlar.
+static const char *const VALVE_FIELD_NAMES[] = {
+  "state", "mode", "pwmValue", "heartRate", "useDynamicPulse", "manualPulseDuration", "usePQRST",
+  "pWaveDuration", "prSegmentDuration", "rWaveDuration", "stSegmentDuration", "tWaveDuration",
+  "pWavePwm", "rWavePwm", "tWavePwm", "waveShape", "pulseDelay"
+};
+#define NUM_VALVE_FIELDS (sizeof(VALVE_FIELD_NAMES) / sizeof(VALVE_FIELD_NAMES[0]))
+
+static int32_t valveFieldValue(const ValveControl &valve, int field) {
+  switch (field) {
+    case SET_STATE: return valve.state;
+    case SET_MODE: return valve.mode;
+    case SET_PWM_VALUE: return valve.pwmValue;
+    case SET_HEART_RATE: return valve.heartRate;
+    case SET_DYNAMIC_PULSE: return valve.useDynamicPulse;
+    case SET_MANUAL_PULSE_DURATION: return valve.manualPulseDuration;
+    case SET_USE_PQRST: return valve.usePQRST;
+    case SET_P_WAVE_DURATION: return valve.pWaveDuration;
+    case SET_PR_SEGMENT_DURATION: return valve.prSegmentDuration;
+    case SET_R_WAVE_DURATION: return valve.rWaveDuration;
+    case SET_ST_SEGMENT_DURATION: return valve.stSegmentDuration;
+    case SET_T_WAVE_DURATION: return valve.tWaveDuration;
+    case SET_P_WAVE_PWM: return valve.pWavePwm;
+    case SET_R_WAVE_PWM: return valve.rWavePwm;
+    case SET_T_WAVE_PWM: return valve.tWavePwm;
+    case SET_WAVE_SHAPE: return valve.waveShape;
+    case SET_PULSE_DELAY: return valve.pulseDelay;
+  }
+  return 0;
+}
+
+// Valfi JSON nesnesi olarak yazar. previous verilirse yalnızca değişen alanlar yazılır;
+// hiçbir alan değişmediyse hiçbir şey yazmaz ve false döner.
+static bool appendValveJson(JsonBuffer &out, int valveIndex, const ValveControl &valve, const ValveControl *previous) {
+  bool any = false;
+  for (int field = 0; field < (int)NUM_VALVE_FIELDS; field++) {
+    int32_t value = valveFieldValue(valve, field);
+    if (previous != NULL && valveFieldValue(*previous, field) == value) continue;
+    if (!any) out.append("{\"id\":%d", valveIndex);
+    out.append(",");
+    any = true;
+    if (field == SET_MODE) {
+      out.append("\"mode\":\"%s\"", value == MANUAL_PWM ? "MANUAL_PWM" : "HEART_RHYTHM");
+    } else if (field == SET_STATE || field == SET_DYNAMIC_PULSE || field == SET_USE_PQRST) {
+      out.append("\"%s\":%s", VALVE_FIELD_NAMES[field], value ? "true" : "false");
+    } else {
+      out.append("\"%s\":%ld", VALVE_FIELD_NAMES[field], (long)value);
+    }
+  }
+  if (any) out.append("}");
+  return any;
+}
+
+// {"valves":[...]} biçiminde tüm durum ya da (previous ile) yalnızca değişenler.
+// Değişiklik yoksa false döner.
+static bool appendValvesJson(JsonBuffer &out, const ValveControl *snapshot, const ValveControl *previous) {
+  size_t start = out.length;
+  bool any = false;
+  out.append("{\"valves\":[");
+  for (int i = 0; i < NUM_VALVES; i++) {
+    size_t mark = out.length;
+    if (any) out.append(",");
+    if (appendValveJson(out, i, snapshot[i], previous ? &previous[i] : NULL)) {
+      any = true;
+    } else {
+      out.length = mark; out.data[mark] = '\0';
+    }
+  }
+  out.append("]}");
+  if (!any && previous != NULL) { out.length = start; out.data[start] = '\0'; }
+  return any || previous == NULL;
+}
+
+static WiFiClient streamClients[MAX_STREAM_CLIENTS];
+static ValveControl streamSnapshot[NUM_VALVES];
+static ValveControl streamLastSent[NUM_VALVES];
+static uint32_t streamLastSeq = 0;
+static unsigned long streamLastTick = 0;
+static unsigned long streamLastWrite = 0;
+static char jsonBuffer[JSON_BUFFER_SIZE];
+
+static bool writeStreamClient(WiFiClient &client, const char *data, size_t length) {
+  if (!client.connected() || client.write((const uint8_t *)data, length) != length) {
+    client.stop();
+    return false;
+  }
+  return true;
+}
+
+// GET /events: bağlantıyı abone listesine alır ve ilk olarak tüm durumu gönderir.
+void handleEvents() {
+  int slot = -1;
+  for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+    if (!streamClients[i].connected()) { slot = i; break; }
+  }
+  if (slot < 0) {
+    server.send(503, "text/plain", "Cok fazla canli baglanti");
+    return;
+  }
+  WiFiClient client = server.client();
+  client.setNoDelay(true);
+  static const char header[] = "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\nConnection: keep-alive\r\n\r\n";
+  if (!writeStreamClient(client, header, sizeof(header) - 1)) return;
+
+  // Yeni abone önce tam durumu alır; sonraki mesajlar yalnızca değişiklikleri içerir
+  readValveStatus(streamSnapshot);
+  JsonBuffer out(jsonBuffer, sizeof(jsonBuffer));
+  out.append("event: status\ndata: ");
+  appendValvesJson(out, streamSnapshot, NULL);
+  out.append("\n\n");
+  if (!out.overflow && writeStreamClient(client, out.data, out.length)) {
+    streamClients[slot] = client;
+  }
+}
+
+// Web görevinin her turunda çağrılır; değişiklikleri ve atış olaylarını tüm abonelere yollar.
+void pumpStatusStream() {
+  unsigned long now = millis();
+  if (now - streamLastTick < STREAM_INTERVAL_MS) return;
+  streamLastTick = now;
+
+  int subscribers = 0;
+  for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+    if (streamClients[i].connected()) subscribers++;
+  }
+
+  JsonBuffer out(jsonBuffer, sizeof(jsonBuffer));
+  uint32_t seq = statusSeq.load(std::memory_order_acquire);
+  if (seq != streamLastSeq) {
+    readValveStatus(streamSnapshot);
+    size_t mark = out.length;
+    out.append("event: status\ndata: ");
+    if (appendValvesJson(out, streamSnapshot, streamLastSent)) {
+      out.append("\n\n");
+    } else {
+      out.length = mark; out.data[mark] = '\0';
+    }
+    memcpy(streamLastSent, streamSnapshot, sizeof(streamLastSent));
+    streamLastSeq = seq;
+  }
+
+  BeatEvent event;
+  bool anyBeat = false;
+  while (beatEvents.pop(event)) {
+    // Dinleyen yoksa ya da tamponda yer kalmadıysa olay düşer
+    if (subscribers == 0 || out.size - out.length < BEAT_EVENT_JSON_MAX) continue;
+    out.append(anyBeat ? "," : "event: beat\ndata: [");
+    out.append("{\"id\":%d,\"phase\":\"%s\",\"t\":%lu}", event.valve, event.phase == BEAT_START ? "start" : "end", (unsigned long)event.timeMs);
+    anyBeat = true;
+  }
+  if (anyBeat) out.append("]\n\n");
+
+  if (out.length == 0 && now - streamLastWrite >= STREAM_KEEPALIVE_MS) {
+    out.append(": canli\n\n"); // kopan bağlantıları fark etmek için yorum satırı
+  }
+  if (out.length == 0 || out.overflow || subscribers == 0) return;
+  streamLastWrite = now;
+  for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+    if (streamClients[i].connected()) writeStreamClient(streamClients[i], out.data, out.length);
+  }
+}
+
+#endif
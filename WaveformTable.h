@@ -0,0 +1,154 @@
+#ifndef WAVEFORM_TABLE_H
+#define WAVEFORM_TABLE_H
+
+// Tablo tabanlı dalga biçimi motoru.
+// Her valfin ayarları, /set ile değiştiğinde bir kez (görev oranı, süre) parçalarından oluşan
+// bir tabloya derlenir. Ritim motoru atış başladığında tabloyu sırayla çalar: her olayda
+// tek yapılan tablo indeksini ilerletip görev oranını yazmaktır. Düz bölümler tek parça
+// olduğundan zamanlayıcı yalnızca değer değiştiğinde uyanır; rampalar ise sabit
+// WAVE_RAMP_STEP_TICKS aralıklı örneklerle çalınır.
+
+#define WAVE_TICK_US 1000          // parça sürelerinin birimi (1 ms)
+#define WAVE_RAMP_STEP_TICKS 4     // yumuşak dalgalarda örnek aralığı
+#define WAVE_MAX_SEGMENTS 256
+#define WAVE_LEVEL_MAX 255         // zarf seviyesi, pwmValue'nun 255'te kaçı
+#define CUSTOM_WAVE_MAX_SAMPLES 250
+#define DICROTIC_WAVE_PERCENT 20   // dikrotik dalganın R dalgasına oranı
+
+struct WaveSegment {
+  uint16_t duty; uint16_t ticks;
+};
+
+struct WaveTable {
+  WaveSegment segments[WAVE_MAX_SEGMENTS]; uint16_t length;
+};
+
+#include "wave_tables.h" // varsayılan zarflar, tools/build_wave_tables.py üretir
+
+// Kullanıcının yüklediği dalga: sampleMs aralıklı, % cinsinden örnekler
+struct CustomWave {
+  uint8_t levels[CUSTOM_WAVE_MAX_SAMPLES]; uint8_t length; uint8_t sampleMs;
+};
+
+static WaveTable waveTables[NUM_VALVES];     // yalnızca ritim motoru yazar ve okur
+static CustomWave customWaves[NUM_VALVES];   // motorun kopyası, komut kuyruğuyla dolar
+static CustomWave uploadedWaves[NUM_VALVES]; // web tarafının kopyası (kaydetme için)
+
+// Aynı seviyedeki ardışık parçaları birleştirir; tablo dolarsa son parçayı uzatır.
+void appendWaveSegment(WaveTable &table, uint16_t level, uint32_t ticks) {
+  while (ticks > 0) {
+    uint16_t chunk = ticks > 0xFFFF ? 0xFFFF : (uint16_t)ticks;
+    ticks -= chunk;
+    if (table.length > 0) {
+      WaveSegment &last = table.segments[table.length - 1];
+      if ((last.duty == level || table.length == WAVE_MAX_SEGMENTS) && last.ticks + chunk <= 0xFFFF) {
+        last.ticks += chunk;
+        continue;
+      }
+    }
+    if (table.length == WAVE_MAX_SEGMENTS) return;
+    table.segments[table.length].duty = level;
+    table.segments[table.length].ticks = chunk;
+    table.length++;
+  }
+}
+
+// tools/build_wave_tables.py bu fonksiyonların aynısını varsayılan zarflar için çalıştırır;
+// hesap değişirse orası da güncellenip wave_tables.h yeniden üretilmelidir.
+
+// 0'dan tepeye çıkıp 0'a inen yumuşak tümsek; pos/len konumundaki değer (0..1024).
+uint32_t smoothBump(uint32_t pos, uint32_t len) {
+  uint32_t x = (uint64_t)pos * 2048 / len; // 0..2048; pos * 2048 32 bite sığmayabilir
+  if (x > 1024) x = 2048 - x;           // simetrik
+  return x * x * (3072 - 2 * x) / (1024 * 1024); // smoothstep, 0..1024
+}
+
+void appendWaveLobe(WaveTable &table, uint16_t peak, uint32_t ticks, bool smooth) {
+  if (!smooth) {
+    appendWaveSegment(table, peak, ticks);
+    return;
+  }
+  // start + len hiçbir zaman ticks'i aşmaz; ticks UINT32_MAX'a yakın olsa da döngü taşmaz.
+  for (uint32_t start = 0; start < ticks; ) {
+    uint32_t len = ticks - start < WAVE_RAMP_STEP_TICKS ? ticks - start : WAVE_RAMP_STEP_TICKS;
+    if (table.length == WAVE_MAX_SEGMENTS) {
+      // Tablo doldu; kalan parçalar zaten son parçaya eklenecekti, tek seferde eklenir
+      appendWaveSegment(table, 0, ticks - start);
+      return;
+    }
+    appendWaveSegment(table, (uint16_t)(peak * smoothBump(start + len / 2, ticks) / 1024), len);
+    start += len;
+  }
+}
+
+uint16_t percentToLevel(uint32_t percent) {
+  return (uint16_t)((percent > 100 ? 100 : percent) * WAVE_LEVEL_MAX / 100);
+}
+
+// PQRST zarfını seviye (0..WAVE_LEVEL_MAX) cinsinden kurar. Yumuşak biçimde P, R ve T
+// tümsek şeklindedir ve S-T aralığına dikrotik çentikten sonra küçük bir dalga eklenir.
+void buildPqrstEnvelope(WaveTable &table, uint32_t pDur, uint32_t prDur, uint32_t rDur, uint32_t stDur, uint32_t tDur,
+                                  uint32_t pPwm, uint32_t rPwm, uint32_t tPwm, bool smooth) {
+  table.length = 0;
+  appendWaveLobe(table, percentToLevel(pPwm), pDur, smooth);
+  appendWaveSegment(table, 0, prDur);
+  appendWaveLobe(table, percentToLevel(rPwm), rDur, smooth);
+  if (smooth) {
+    appendWaveLobe(table, percentToLevel(rPwm * DICROTIC_WAVE_PERCENT / 100), stDur, true);
+  } else {
+    appendWaveSegment(table, 0, stDur);
+  }
+  appendWaveLobe(table, percentToLevel(tPwm), tDur, smooth);
+}
+
+// Varsayılan zarflar wave_tables.h'de hazır durur; derlenmeden kopyalanır.
+static void copyWaveSegments(WaveTable &table, const WaveSegment *segments, uint16_t length) {
+  memcpy(table.segments, segments, length * sizeof(WaveSegment));
+  table.length = length;
+}
+
+static bool hasDefaultPqrstTiming(const ValveControl &valve) {
+  return valve.pWaveDuration == DEFAULT_P_WAVE_DURATION && valve.prSegmentDuration == DEFAULT_PR_SEGMENT_DURATION &&
+         valve.rWaveDuration == DEFAULT_R_WAVE_DURATION && valve.stSegmentDuration == DEFAULT_ST_SEGMENT_DURATION &&
+         valve.tWaveDuration == DEFAULT_T_WAVE_DURATION && valve.pWavePwm == DEFAULT_P_WAVE_PWM &&
+         valve.rWavePwm == DEFAULT_R_WAVE_PWM && valve.tWavePwm == DEFAULT_T_WAVE_PWM;
+}
+
+// Valfin ayarlarını çalınacak tabloya derler. Yalnızca ritim motoru görevinden çağrılır.
+void compileValveWaveform(int valveIndex) {
+  const ValveControl &valve = valves[valveIndex];
+  WaveTable &table = waveTables[valveIndex];
+  table.length = 0;
+
+  if (!valve.usePQRST) {
+    uint64_t pulseUs = valve.useDynamicPulse ? max(20000UL, valve.beatInterval / 4) : valve.manualPulseDuration * 1000ULL;
+    appendWaveSegment(table, WAVE_LEVEL_MAX, (uint32_t)(pulseUs / WAVE_TICK_US));
+  } else if (valve.waveShape == WAVE_CUSTOM) {
+    const CustomWave &wave = customWaves[valveIndex];
+    for (int i = 0; i < wave.length; i++) {
+      appendWaveSegment(table, percentToLevel(wave.levels[i]), wave.sampleMs);
+    }
+  } else if (hasDefaultPqrstTiming(valve)) {
+    if (valve.waveShape == WAVE_ECG) {
+      copyWaveSegments(table, DEFAULT_ECG_SEGMENTS, sizeof(DEFAULT_ECG_SEGMENTS) / sizeof(WaveSegment));
+    } else {
+      copyWaveSegments(table, DEFAULT_SQUARE_SEGMENTS, sizeof(DEFAULT_SQUARE_SEGMENTS) / sizeof(WaveSegment));
+    }
+  } else {
+    buildPqrstEnvelope(table, valve.pWaveDuration, valve.prSegmentDuration, valve.rWaveDuration, valve.stSegmentDuration,
+                       valve.tWaveDuration, valve.pWavePwm, valve.rWavePwm, valve.tWavePwm, valve.waveShape == WAVE_ECG);
+  }
+
+  // Boş zarf (tüm PQRST süreleri 0 ya da yüklenmemiş özel dalga) çalınacak bir şey
+  // bırakmaz; yerine varsayılan kare zarf çalınır.
+  if (table.length == 0) {
+    copyWaveSegments(table, DEFAULT_SQUARE_SEGMENTS, sizeof(DEFAULT_SQUARE_SEGMENTS) / sizeof(WaveSegment));
+  }
+
+  // Seviyeleri görev oranına çevir; çalma sırasında çarpma yapılmaz.
+  for (int i = 0; i < table.length; i++) {
+    table.segments[i].duty = (uint32_t)constrain(valve.pwmValue, 0, 4095) * table.segments[i].duty / WAVE_LEVEL_MAX;
+  }
+}
+
+#endif
@@ -0,0 +1,500 @@
+// Taslağın bilgisayarda, sanal saatle çalışan ölçüm programı.
+//
+// kalp_ritm.ino ve başlıkları olduğu gibi derlenir; donanım ve ağ host/stubs/ altındaki
+// taklitlerle değiştirilir. Ritim motoru görev yerine runRhythmEngineOnce() ile adım adım
+// sürülür ve saat, motorun döndürdüğü bir sonraki olay zamanına (isteğe bağlı uyanma
+// gecikmesiyle) atlatılır. PCA9685'e giden her I2C işlemi çözülüp kanal bazında izlenir.
+//
+// Ölçülenler:
+//   - kanal başına atış zamanlama hatası: çıkışın değiştiği I2C işleminin bittiği an ile
+//     ritim ızgarasındaki planlanan an arasındaki fark ve çalışma boyunca kayması
+//   - saniyede I2C işlemi, kanal yazımı, bayt ve veri yolu doluluğu
+//   - motor turu başına host CPU süresi
+//   - HTTP işleyicilerinin host CPU süresi ve istek başına heap ayırma sayısı
+// Denetlenenler: tüm kanallar sürülür, atış düşmez, toplu güncelleme atışın ortasında tablo
+// değiştirmez, üretilmiş varsayılan zarflar çalışma zamanı hesabıyla aynıdır.
+// Denetimlerden biri başarısızsa çıkış kodu 1'dir. Süreler ESP32 değil host süreleridir;
+// değişiklikler arasında karşılaştırma içindir.
+
+#include <Arduino.h>
+#include "../kalp_ritm.ino"
+
+#include <chrono>
+#include <csignal>
+#include <unistd.h>
+#include <cmath>
+#include <new>
+#include <vector>
+
+#define SCENARIO_SECONDS 60
+#define EDGE_ERROR_LIMIT_US 2000 // uyanma gecikmesine ek olarak izin verilen hata (I2C süresi dahil)
+#define DRIFT_LIMIT_US 50     // uyanma gecikmesinin yarısına ek olarak
+#define HTTP_ITERATIONS 2000
+#define BENCH_TIMEOUT_S 60     // motor turu dönmezse (sonsuz döngü) program burada düşer
+
+// ---- Heap ayırma sayacı
+
+static uint64_t allocationCount = 0;
+static uint64_t allocationBytes = 0;
+
+void *operator new(size_t size) {
+  allocationCount++;
+  allocationBytes += size;
+  void *block = malloc(size ? size : 1);
+  if (block == NULL) throw std::bad_alloc();
+  return block;
+}
+void operator delete(void *block) noexcept { free(block); }
+void operator delete(void *block, size_t size) noexcept { free(block); }
+
+// ---- Yardımcılar
+
+static int failures = 0;
+
+static void check(bool ok, const char *format, ...) {
+  if (ok) return;
+  failures++;
+  va_list args;
+  va_start(args, format);
+  printf("  HATA: ");
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static uint64_t wallNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t randomState = 12345;
+static uint32_t nextRandom() {
+  randomState = randomState * 1664525u + 1013904223u;
+  return randomState >> 8;
+}
+
+struct Samples {
+  std::vector<int64_t> values;
+  void add(int64_t value) { values.push_back(value); }
+  void clear() { values.clear(); }
+  bool empty() const { return values.empty(); }
+  double mean() const {
+    double sum = 0;
+    for (int64_t value : values) sum += value;
+    return values.empty() ? 0 : sum / values.size();
+  }
+  // En küçük kareler doğrusunun ilk örnekten son örneğe değişimi (sürekli kayma).
+  double trend() const {
+    size_t n = values.size();
+    if (n < 2) return 0;
+    double meanIndex = (n - 1) / 2.0, meanValue = mean(), num = 0, den = 0;
+    for (size_t i = 0; i < n; i++) {
+      num += (i - meanIndex) * (values[i] - meanValue);
+      den += (i - meanIndex) * (i - meanIndex);
+    }
+    return num / den * (n - 1);
+  }
+  int64_t percentile(double p) const {
+    if (values.empty()) return 0;
+    std::vector<int64_t> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[min(sorted.size() - 1, (size_t)(p * sorted.size()))];
+  }
+  int64_t maximum() const { return values.empty() ? 0 : *std::max_element(values.begin(), values.end()); }
+};
+
+// ---- Motoru sürme
+
+static Samples engineStepNs;
+
+static uint64_t engineStep() {
+  uint64_t start = wallNanos();
+  uint64_t deadline = runRhythmEngineOnce();
+  engineStepNs.add(wallNanos() - start);
+  return deadline;
+}
+
+// vTaskDelay(): web tarafı beklerken diğer çekirdekteki motor bir tur döner.
+static void engineYield() {
+  runRhythmEngineOnce();
+}
+
+// Motoru sanal saatte durationUs boyunca çalıştırır. Her uyanma 0..jitterUs gecikir.
+static void runFor(uint64_t durationUs, uint32_t jitterUs) {
+  uint64_t end = hostNowMicros + durationUs;
+  while (hostNowMicros < end) {
+    uint64_t deadline = engineStep();
+    if (deadline == 0) break;
+    uint64_t wake = max(deadline, hostNowMicros) + (jitterUs > 0 ? nextRandom() % (jitterUs + 1) : 0);
+    hostNowMicros = min(wake, end);
+  }
+  hostNowMicros = end;
+}
+
+// İstek ve ardından motorun uyanması (pushValveCommand'ın bildirimi).
+static int request(HTTPMethod method, const char *uri, const std::string &body = "") {
+  int code = server.request(method, uri, body.c_str());
+  engineStep();
+  return code;
+}
+
+// ---- I2C izleme
+
+struct ChannelTrace {
+  int duty = -1;                // son yazılan görev oranı, -1: henüz yazılmadı
+  int64_t lastBeat = -1;        // son atışın ızgara sırası
+  uint32_t beats = 0;
+  uint32_t droppedBeats = 0;
+  uint32_t mixedBeats = 0;
+  int64_t maxEdgeErrorUs = 0;
+  Samples startErrorUs;         // atışın ilk yükselen kenarının hatası, atış sırasıyla
+  std::vector<int> beatDuties;  // içinde bulunulan atışta yazılan görev oranları
+};
+
+static ChannelTrace traces[NUM_VALVES];
+static uint64_t i2cCount = 0, i2cWrites = 0, i2cBytes = 0, i2cBusUs = 0;
+static int mixCheckPwm[2] = { 0, 0 }; // ikisi de doluysa atışlar bu iki pwmValue'dan birine ait olmalı
+
+static uint64_t i2cBusMicros(size_t length) {
+  uint64_t bits = 2 + 9ULL * (1 + length);
+  return (bits * 1000000ULL + I2C_CLOCK_HZ - 1) / I2C_CLOCK_HZ;
+}
+
+// Kare PQRST zarfındaki seviyelerin pwmValue ile ölçeklenmiş hali bu görev oranını veriyor mu?
+static bool dutyBelongsTo(int duty, int pwmValue) {
+  for (const WaveSegment &segment : DEFAULT_SQUARE_SEGMENTS) {
+    if (segment.duty > 0 && (int)((uint32_t)pwmValue * segment.duty / WAVE_LEVEL_MAX) == duty) return true;
+  }
+  return false;
+}
+
+static void finishBeat(ChannelTrace &trace) {
+  if (mixCheckPwm[0] > 0 && !trace.beatDuties.empty()) {
+    bool fitsFirst = true, fitsSecond = true;
+    for (int duty : trace.beatDuties) {
+      fitsFirst = fitsFirst && dutyBelongsTo(duty, mixCheckPwm[0]);
+      fitsSecond = fitsSecond && dutyBelongsTo(duty, mixCheckPwm[1]);
+    }
+    if (!fitsFirst && !fitsSecond) trace.mixedBeats++;
+  }
+  trace.beatDuties.clear();
+}
+
+// Kenarın planlanan anı: valfin ızgarasındaki atış + tablodaki parça başlangıcı (ya da sonu).
+static void onDutyChange(int channel, int duty, uint64_t time) {
+  ChannelTrace &trace = traces[channel];
+  bool firstWrite = trace.duty < 0;
+  trace.duty = duty;
+  const ValveControl &valve = valves[channel];
+  if (firstWrite || !valve.state || valve.mode != HEART_RHYTHM) return;
+  uint64_t origin = rhythmEpoch + valve.pulseDelay * 1000ULL;
+  if (time < origin) return;
+  int64_t beat = (time - origin) / valve.beatInterval;
+  uint64_t phase = (time - origin) % valve.beatInterval;
+
+  const WaveTable &table = waveTables[channel];
+  uint64_t offset = 0, planned = 0, lead = 0;
+  bool leadFound = false;
+  for (int i = 0; i <= table.length; i++) {
+    if (offset <= phase) planned = offset;
+    if (i == table.length) break;
+    if (!leadFound && table.segments[i].duty > 0) { lead = offset; leadFound = true; }
+    offset += table.segments[i].ticks * (uint64_t)WAVE_TICK_US;
+  }
+  int64_t error = phase - planned;
+  trace.maxEdgeErrorUs = max(trace.maxEdgeErrorUs, error);
+
+  if (duty > 0 && leadFound && planned == lead) {
+    trace.startErrorUs.add(error);
+    if (trace.lastBeat >= 0 && beat > trace.lastBeat + 1) trace.droppedBeats += beat - trace.lastBeat - 1;
+    finishBeat(trace);
+    trace.lastBeat = beat;
+    trace.beats++;
+  }
+  if (duty > 0) trace.beatDuties.push_back(duty);
+}
+
+static void onI2cTransfer(uint8_t address, const uint8_t *data, size_t length, uint64_t doneAt) {
+  i2cCount++;
+  i2cBytes += length;
+  i2cBusUs += i2cBusMicros(length);
+  if (address != PCA9685_ADDRESS || length < 5 || data[0] < PCA9685_LED0_ON_L) return;
+  int first = (data[0] - PCA9685_LED0_ON_L) / 4;
+  for (size_t i = 1; i + 4 <= length; i += 4) {
+    int channel = first + (int)(i - 1) / 4;
+    if (channel >= NUM_VALVES) break;
+    i2cWrites++;
+    uint16_t on = data[i] | (data[i + 1] << 8);
+    uint16_t off = data[i + 2] | (data[i + 3] << 8);
+    int duty = (off & PCA9685_FULL_OFF) ? 0 : (off - on) & 0x0FFF;
+    if (duty != traces[channel].duty) onDutyChange(channel, duty, doneAt);
+  }
+}
+
+static void resetMeasurements() {
+  for (ChannelTrace &trace : traces) {
+    int duty = trace.duty;
+    trace = ChannelTrace();
+    trace.duty = duty;
+  }
+  i2cCount = i2cWrites = i2cBytes = i2cBusUs = 0;
+  engineStepNs.clear();
+  memset(valveLatenessUs, 0, sizeof(valveLatenessUs));
+}
+
+// ---- Senaryolar
+
+struct Scenario {
+  const char *name;
+  uint32_t jitterUs;
+  std::string (*valveJson)(int valveIndex); // /set gövdesi, "id" hariç
+};
+
+static std::string squareAt60(int i) {
+  return "\"usePQRST\":false,\"useDynamicPulse\":true,\"heartRate\":60,\"pwmValue\":4095";
+}
+static std::string ecgAt72(int i) {
+  return "\"usePQRST\":true,\"waveShape\":1,\"heartRate\":72,\"pwmValue\":4095";
+}
+static std::string mixedRates(int i) {
+  return "\"usePQRST\":false,\"useDynamicPulse\":true,\"pwmValue\":3000,\"heartRate\":" + std::to_string(40 + i * 100 / (NUM_VALVES - 1));
+}
+static std::string squarePqrstAt60(int i) {
+  return "\"usePQRST\":true,\"waveShape\":0,\"heartRate\":60,\"pwmValue\":4095";
+}
+
+static void configureValves(std::string (*valveJson)(int)) {
+  for (int i = 0; i < NUM_VALVES; i++) {
+    std::string body = "{\"id\":" + std::to_string(i) + ",\"state\":true,\"mode\":\"HEART_RHYTHM\"," + valveJson(i) + "}";
+    check(request(HTTP_POST, "/set", body) == 200, "/set valf %d reddedildi", i);
+  }
+}
+
+static std::string bulkBody(int pwmValue) {
+  std::string body = "{\"valves\":[";
+  for (int i = 0; i < NUM_VALVES; i++) {
+    body += (i > 0 ? ",{\"id\":" : "{\"id\":") + std::to_string(i) + ",\"pwmValue\":" + std::to_string(pwmValue) + "}";
+  }
+  return body + "]}";
+}
+
+static void report(const Scenario &scenario, uint64_t durationUs) {
+  double seconds = durationUs / 1e6;
+  printf("\n== %s: %d valf, %.0f s, uyanma gecikmesi 0..%u us\n", scenario.name, NUM_VALVES, seconds, scenario.jitterUs);
+  printf("kanal  atis  bas.hata ort  bas.hata maks  kenar maks  cihaz maks  kayma\n");
+  for (int ch = 0; ch < NUM_VALVES; ch++) {
+    const ChannelTrace &trace = traces[ch];
+    double drift = trace.startErrorUs.trend();
+    printf("%5d %5u %11.1f %14lld %11lld %11u %6.1f   (us)\n", ch, trace.beats, trace.startErrorUs.mean(),
+           (long long)trace.startErrorUs.maximum(), (long long)trace.maxEdgeErrorUs, valveLatenessUs[ch].max, drift);
+
+    uint32_t expected = durationUs / valves[ch].beatInterval;
+    check(trace.beats + 2 >= expected, "kanal %d: %u atis, beklenen ~%u", ch, trace.beats, expected);
+    check(trace.droppedBeats == 0, "kanal %d: %u atis dustu", ch, trace.droppedBeats);
+    check(trace.mixedBeats == 0, "kanal %d: %u atista tablo atisin ortasinda degisti", ch, trace.mixedBeats);
+    check(trace.maxEdgeErrorUs <= (int64_t)scenario.jitterUs + EDGE_ERROR_LIMIT_US, "kanal %d: kenar hatasi %lld us",
+          ch, (long long)trace.maxEdgeErrorUs);
+    check(std::fabs(drift) <= DRIFT_LIMIT_US + scenario.jitterUs / 2, "kanal %d: %.1f us kayma", ch, drift);
+    // Cihazın ölçtüğü kenar gecikmesi hatta görülenden az olmamalı (I2C aktarımı dahil)
+    check((int64_t)valveLatenessUs[ch].max >= trace.maxEdgeErrorUs, "kanal %d: cihaz kenar gecikmesi %u us, hatta %lld us",
+          ch, valveLatenessUs[ch].max, (long long)trace.maxEdgeErrorUs);
+  }
+  printf("I2C: %.0f islem/s, %.0f kanal yazimi/s, %.0f bayt/s, veri yolu %%%.2f dolu, islem basina %.1f kanal\n",
+         i2cCount / seconds, i2cWrites / seconds, i2cBytes / seconds, 100.0 * i2cBusUs / durationUs,
+         i2cCount ? (double)i2cWrites / i2cCount : 0.0);
+  printf("motor turu (host): %zu tur, ort %.0f ns, p99 %lld ns, maks %lld ns\n", engineStepNs.values.size(),
+         engineStepNs.mean(), (long long)engineStepNs.percentile(0.99), (long long)engineStepNs.maximum());
+}
+
+static void runScenario(const Scenario &scenario) {
+  configureValves(scenario.valveJson);
+  runFor(2000000, 0); // ilk atışlar ve geçişler ölçüme girmesin
+  resetMeasurements();
+  uint64_t durationUs = SCENARIO_SECONDS * 1000000ULL;
+  runFor(durationUs, scenario.jitterUs);
+  for (ChannelTrace &trace : traces) finishBeat(trace);
+  report(scenario, durationUs);
+}
+
+// Atış sınırında uygulanan toplu güncellemeler: rastgele anlarda tüm valflerin pwmValue'su
+// 4095 ile 2000 arasında değiştirilir. Hiçbir atış düşmemeli ve tek bir atış iki
+// ayarın karışımıyla çalınmamalı.
+static void runBulkScenario() {
+  Scenario scenario = { "toplu-guncelleme", 200, squarePqrstAt60 };
+  configureValves(scenario.valveJson);
+  runFor(2000000, 0);
+  resetMeasurements();
+  mixCheckPwm[0] = 4095;
+  mixCheckPwm[1] = 2000;
+  uint64_t start = hostNowMicros, end = start + SCENARIO_SECONDS * 1000000ULL;
+  int updates = 0;
+  while (hostNowMicros < end) {
+    runFor(min(end - hostNowMicros, (uint64_t)(500000 + nextRandom() % 2000000)), scenario.jitterUs);
+    if (hostNowMicros >= end) break;
+    check(request(HTTP_POST, "/bulk", bulkBody(updates % 2 ? 4095 : 2000)) == 200, "/bulk reddedildi");
+    updates++;
+  }
+  for (ChannelTrace &trace : traces) finishBeat(trace);
+  mixCheckPwm[0] = mixCheckPwm[1] = 0;
+  printf("\n(%d toplu guncelleme)", updates);
+  report(scenario, end - start);
+}
+
+// ---- HTTP işleyicileri
+
+static void benchRoute(const char *label, HTTPMethod method, const char *uri, const std::string &body) {
+  Samples nanos;
+  uint64_t allocations = 0, bytes = 0;
+  for (int i = 0; i < HTTP_ITERATIONS; i++) {
+    uint64_t allocationsBefore = allocationCount, bytesBefore = allocationBytes;
+    uint64_t start = wallNanos();
+    int code = server.request(method, uri, body.c_str());
+    nanos.add(wallNanos() - start);
+    allocations += allocationCount - allocationsBefore;
+    bytes += allocationBytes - bytesBefore;
+    engineStep(); // motor kuyruğu boşaltsın
+    hostNowMicros += 1000;
+    if (code != 200) {
+      check(false, "%s %d dondu", label, code);
+      return;
+    }
+  }
+  printf("%-22s %8.1f %8.1f %8.1f %10.1f %10.0f\n", label, nanos.mean() / 1000, nanos.percentile(0.99) / 1000.0,
+         nanos.maximum() / 1000.0, (double)allocations / HTTP_ITERATIONS, (double)bytes / HTTP_ITERATIONS);
+}
+
+static void runHttpBench() {
+  printf("\n== HTTP isleyicileri (host, %d istek)\n", HTTP_ITERATIONS);
+  printf("istek                   ort us   p99 us  maks us  ayirma/ist  bayt/ist\n");
+  benchRoute("GET /status", HTTP_GET, "/status", "");
+  benchRoute("POST /set", HTTP_POST, "/set", "{\"id\":3,\"heartRate\":75,\"pwmValue\":3000}");
+  benchRoute("POST /set (yeniden)", HTTP_POST, "/set", "{\"id\":3,\"state\":true,\"mode\":\"HEART_RHYTHM\",\"usePQRST\":true}");
+  benchRoute("POST /bulk (16 valf)", HTTP_POST, "/bulk", bulkBody(3000));
+  benchRoute("GET /viewsettings", HTTP_GET, "/viewsettings", "");
+  benchRoute("GET /metrics", HTTP_GET, "/metrics", "");
+  benchRoute("GET /save", HTTP_GET, "/save", "");
+}
+
+// ---- Tek seferlik denetimler
+
+static bool sameSegments(const WaveTable &table, const WaveSegment *segments, size_t length) {
+  if (table.length != length) return false;
+  for (size_t i = 0; i < length; i++) {
+    if (table.segments[i].duty != segments[i].duty || table.segments[i].ticks != segments[i].ticks) return false;
+  }
+  return true;
+}
+
+static void checkDefaultTables() {
+  static WaveTable table;
+  buildPqrstEnvelope(table, DEFAULT_P_WAVE_DURATION, DEFAULT_PR_SEGMENT_DURATION, DEFAULT_R_WAVE_DURATION,
+                     DEFAULT_ST_SEGMENT_DURATION, DEFAULT_T_WAVE_DURATION, DEFAULT_P_WAVE_PWM, DEFAULT_R_WAVE_PWM,
+                     DEFAULT_T_WAVE_PWM, false);
+  check(sameSegments(table, DEFAULT_SQUARE_SEGMENTS, sizeof(DEFAULT_SQUARE_SEGMENTS) / sizeof(WaveSegment)),
+        "wave_tables.h kare zarfi guncel degil (tools/build_wave_tables.py)");
+  buildPqrstEnvelope(table, DEFAULT_P_WAVE_DURATION, DEFAULT_PR_SEGMENT_DURATION, DEFAULT_R_WAVE_DURATION,
+                     DEFAULT_ST_SEGMENT_DURATION, DEFAULT_T_WAVE_DURATION, DEFAULT_P_WAVE_PWM, DEFAULT_R_WAVE_PWM,
+                     DEFAULT_T_WAVE_PWM, true);
+  check(sameSegments(table, DEFAULT_ECG_SEGMENTS, sizeof(DEFAULT_ECG_SEGMENTS) / sizeof(WaveSegment)),
+        "wave_tables.h EKG zarfi guncel degil (tools/build_wave_tables.py)");
+}
+
+static void checkBoot() {
+  check(LittleFS.exists(SETTINGS_FILE), "acilista ayar dosyasi yazilmadi");
+  for (int i = 0; i < NUM_VALVES; i++) {
+    check(valves[i].channel == i && valves[i].beatInterval > 0, "valf %d acilista kurulmadi", i);
+  }
+}
+
+// Kaydedilen ayarlar yeniden yüklenince aynı valf durumunu vermeli.
+static void checkSaveLoad() {
+  static ValveControl before[NUM_VALVES], after[NUM_VALVES];
+  check(request(HTTP_GET, "/save") == 200, "/save basarisiz");
+  readValveStatus(before);
+  check(request(HTTP_GET, "/load") == 200, "/load basarisiz");
+  readValveStatus(after);
+  for (int i = 0; i < NUM_VALVES; i++) {
+    check(after[i].heartRate == before[i].heartRate && after[i].pwmValue == before[i].pwmValue &&
+          after[i].usePQRST == before[i].usePQRST && after[i].pulseDelay == before[i].pulseDelay,
+          "valf %d kaydet/yukle sonrasi farkli", i);
+  }
+}
+
+// Arayüzden ulaşılabilen boş zarflar (0 ms atış, tüm PQRST süreleri 0, yüklenmemiş özel
+// dalga) ve taşan süreler (-1) motoru kilitlememeli; valf ızgarada bir sonraki olayı
+// beklemeye devam etmeli.
+static void checkDegenerateEnvelopes() {
+  static const char *cases[] = {
+    "\"usePQRST\":false,\"useDynamicPulse\":false,\"manualPulseDuration\":0",
+    "\"usePQRST\":true,\"waveShape\":0,\"pWaveDuration\":0,\"prSegmentDuration\":0,\"rWaveDuration\":0,"
+    "\"stSegmentDuration\":0,\"tWaveDuration\":0",
+    "\"usePQRST\":true,\"waveShape\":2",
+    "\"usePQRST\":true,\"waveShape\":1,\"tWaveDuration\":-1",
+    "\"usePQRST\":false,\"useDynamicPulse\":false,\"manualPulseDuration\":-1",
+  };
+  for (const char *fields : cases) {
+    std::string body = std::string("{\"id\":0,\"state\":true,\"mode\":\"HEART_RHYTHM\",\"heartRate\":60,") + fields + "}";
+    check(request(HTTP_POST, "/set", body) == 200, "/set reddedildi: %s", fields);
+    runFor(3000000, 0);
+    check(valves[0].nextEventTime > hostNowMicros, "sonraki olay ileride degil: %s", fields);
+    check(waveTables[0].length > 0, "zarf bos kaldi: %s", fields);
+  }
+
+  // Aralık dışı değerler hangi yoldan gelirse gelsin motorda sınırlanır
+  check(request(HTTP_POST, "/set", "{\"id\":0,\"pwmValue\":9999,\"heartRate\":500,\"pWavePwm\":300,"
+                                  "\"rWaveDuration\":-5,\"pulseDelay\":-1,\"waveShape\":7}") == 200,
+        "/set reddedildi (aralik disi)");
+  ValveControl status[NUM_VALVES];
+  readValveStatus(status);
+  check(status[0].pwmValue == 4095 && status[0].heartRate == MAX_BPM && status[0].pWavePwm == 100 &&
+        status[0].rWaveDuration == 0 && status[0].pulseDelay == 0 && status[0].waveShape == WAVE_SQUARE,
+        "aralik disi degerler sinirlanmadi");
+  // Sonraki senaryolar varsayılan zarfı bekler
+  std::string restore = "{\"id\":0,\"state\":false,\"pwmValue\":0,\"heartRate\":60,\"pWavePwm\":" +
+                        std::to_string(DEFAULT_P_WAVE_PWM) + ",\"pulseDelay\":" + std::to_string(DEFAULT_PULSE_DELAYS[0]) +
+                        ",\"useDynamicPulse\":true,\"manualPulseDuration\":50,\"waveShape\":0,"
+                        "\"pWaveDuration\":" + std::to_string(DEFAULT_P_WAVE_DURATION) +
+                        ",\"prSegmentDuration\":" + std::to_string(DEFAULT_PR_SEGMENT_DURATION) +
+                        ",\"rWaveDuration\":" + std::to_string(DEFAULT_R_WAVE_DURATION) +
+                        ",\"stSegmentDuration\":" + std::to_string(DEFAULT_ST_SEGMENT_DURATION) +
+                        ",\"tWaveDuration\":" + std::to_string(DEFAULT_T_WAVE_DURATION) + "}";
+  check(request(HTTP_POST, "/set", restore) == 200, "/set reddedildi (geri yukleme)");
+}
+
+static void onTimeout(int signal) {
+  static const char message[] = "  HATA: zaman asimi, motor turu donmedi\n";
+  fflush(stdout);
+  if (write(STDOUT_FILENO, message, sizeof(message) - 1) < 0) {}
+  _exit(1);
+}
+
+int main(int argc, char **argv) {
+  signal(SIGALRM, onTimeout);
+  alarm(BENCH_TIMEOUT_S);
+  hostSerialEcho = argc > 1 && strcmp(argv[1], "-v") == 0;
+  hostI2cObserver = onI2cTransfer;
+  hostNowMicros = 1000000;
+  setup();
+  hostYield = engineYield;
+
+  checkDefaultTables();
+  checkBoot();
+  checkDegenerateEnvelopes();
+
+  static const Scenario scenarios[] = {
+    { "kare-60bpm", 0, squareAt60 },
+    { "ekg-72bpm", 0, ecgAt72 },
+    { "ekg-72bpm-gecikmeli", 300, ecgAt72 },
+    { "karisik-40-140bpm", 100, mixedRates },
+  };
+  for (const Scenario &scenario : scenarios) runScenario(scenario);
+  runBulkScenario();
+  checkSaveLoad();
+  runHttpBench();
+
+  if (failures > 0) {
+    printf("\n%d denetim basarisiz\n", failures);
+    return 1;
+  }
+  printf("\nTum denetimler gecti\n");
+  return 0;
+}
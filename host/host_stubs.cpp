@@ -0,0 +1,17 @@
+// Taslak dışında kalan host taklitlerinin tekil nesneleri.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <LittleFS.h>
+#include <WiFi.h>
+
+uint64_t hostNowMicros = 0;
+bool hostSerialEcho = false;
+void (*hostYield)() = NULL;
+HostI2cObserver hostI2cObserver = NULL;
+
+HardwareSerial Serial;
+EspClass ESP;
+TwoWire Wire;
+FS LittleFS;
+WiFiClass WiFi;
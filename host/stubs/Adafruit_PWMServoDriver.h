@@ -0,0 +1,19 @@
+#ifndef HOST_ADAFRUIT_PWM_SERVO_DRIVER_H
+#define HOST_ADAFRUIT_PWM_SERVO_DRIVER_H
+
+// Taslak sürücüyü yalnızca açılış ayarı için kullanır; çıkışlar PwmOutput.h'den
+// doğrudan Wire ile yazılır. Açılış yazımları modellenmez.
+
+#include "Wire.h"
+
+class Adafruit_PWMServoDriver {
+public:
+  Adafruit_PWMServoDriver(uint8_t address = 0x40, TwoWire &i2c = Wire) : wire(i2c) {}
+  bool begin(uint8_t prescale = 0) { return wire.begin(); }
+  void setPWMFreq(float frequency) { pwmFrequency = frequency; }
+  float pwmFrequency = 0;
+private:
+  TwoWire &wire;
+};
+
+#endif
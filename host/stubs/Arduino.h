@@ -0,0 +1,146 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Bilgisayarda derleme için Arduino-ESP32 çekirdeğinin taslağın kullandığı kısmı.
+// Zaman sanal saatten (hostNowMicros) okunur; saati yalnızca harness ilerletir.
+// FreeRTOS görevleri gerçekten başlatılmaz: ritim motoru harness tarafından
+// runRhythmEngineOnce() ile adım adım sürülür, vTaskDelay() motoru bir tur döndürür.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <string>
+#include <algorithm>
+#include <atomic>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define PGM_P const char *
+#define IRAM_ATTR
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+
+// Sanal saat (µs); host_stubs.cpp tanımlar, harness ilerletir.
+extern uint64_t hostNowMicros;
+
+inline unsigned long millis() { return (unsigned long)(hostNowMicros / 1000); }
+inline unsigned long micros() { return (unsigned long)hostNowMicros; }
+inline void delay(unsigned long ms) { hostNowMicros += ms * 1000ULL; }
+
+class String {
+public:
+  String() {}
+  String(const char *text) : value(text ? text : "") {}
+  String(const std::string &text) : value(text) {}
+  String(int number) : value(std::to_string(number)) {}
+  String(unsigned number) : value(std::to_string(number)) {}
+  String(long number) : value(std::to_string(number)) {}
+  String(unsigned long number) : value(std::to_string(number)) {}
+  String &operator+=(const String &other) { value += other.value; return *this; }
+  String &operator+=(const char *text) { value += text; return *this; }
+  String &operator+=(char c) { value += c; return *this; }
+  String operator+(const String &other) const { return String(value + other.value); }
+  String operator+(const char *text) const { return String(value + text); }
+  bool operator==(const String &other) const { return value == other.value; }
+  bool operator==(const char *text) const { return value == text; }
+  bool operator!=(const char *text) const { return value != text; }
+  const char *c_str() const { return value.c_str(); }
+  size_t length() const { return value.size(); }
+  bool reserve(size_t size) { value.reserve(size); return true; }
+  int toInt() const { return atoi(value.c_str()); }
+private:
+  std::string value;
+};
+
+struct IPAddress {
+  uint8_t octets[4];
+};
+
+// Yalnızca write() sanaldır; print/println biçimlendirip ona yazar.
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(const uint8_t *data, size_t length) = 0;
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t write(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+  size_t printf(const char *format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    return written > 0 ? write((const uint8_t *)line, min((size_t)written, sizeof(line) - 1)) : 0;
+  }
+  size_t print(const char *text) { return write(text); }
+  size_t print(const String &text) { return write(text.c_str()); }
+  size_t print(int number) { return printf("%d", number); }
+  size_t print(unsigned number) { return printf("%u", number); }
+  size_t print(long number) { return printf("%ld", number); }
+  size_t print(unsigned long number) { return printf("%lu", number); }
+  size_t print(double number) { return printf("%.2f", number); }
+  size_t print(const IPAddress &ip) { return printf("%u.%u.%u.%u", ip.octets[0], ip.octets[1], ip.octets[2], ip.octets[3]); }
+  template <class T> size_t println(const T &value) { return print(value) + println(); }
+  size_t println() { return write("\r\n"); }
+};
+
+class Stream : public Print {
+public:
+  virtual int read() = 0;
+  size_t write(const uint8_t *data, size_t length) override { return 0; }
+};
+
+// Seri çıktı stderr'e gider; hostSerialEcho kapalıysa yutulur (ölçüm çıktısı temiz kalsın).
+extern bool hostSerialEcho;
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) {}
+  size_t write(const uint8_t *data, size_t length) override {
+    if (hostSerialEcho) fwrite(data, 1, length, stderr);
+    return length;
+  }
+  using Print::write;
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 180000; }
+  uint32_t getMaxAllocHeap() { return 110000; }
+};
+extern EspClass ESP;
+
+// FreeRTOS
+typedef void *TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void (*TaskFunction_t)(void *);
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// Görev gövdeleri sonsuz döngü olduğundan çalıştırılmaz; tutamaç dolu döner ki komutlar
+// kuyruğa girsin. vTaskDelay() ise diğer çekirdeği temsilen hostYield'i çağırır
+// (harness onu bir motor turuna bağlar).
+extern void (*hostYield)();
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stack, void *arg,
+                                          UBaseType_t priority, TaskHandle_t *handle, BaseType_t core) {
+  static int dummyTask;
+  if (handle != NULL) *handle = &dummyTask;
+  return pdPASS;
+}
+inline void vTaskDelete(TaskHandle_t task) {}
+inline void vTaskDelay(TickType_t ticks) { if (hostYield != NULL) hostYield(); }
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task) { return pdPASS; }
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) { return 1; }
+
+#endif
@@ -0,0 +1,408 @@
+#ifndef HOST_ARDUINO_JSON_H
+#define HOST_ARDUINO_JSON_H
+
+// ArduinoJson 7 arayüzünün taslağın kullandığı alt kümesi: ayrıştırma, ağaç üzerinde
+// okuma/yazma ve sıkışık serileştirme. Düğümler tek tek heap'ten ayrılır; gerçek
+// kütüphanenin havuz ayırıcısından farklı olduğundan ayırma sayıları yalnızca göreli
+// karşılaştırma içindir.
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "Arduino.h"
+
+struct JsonNode {
+  enum Kind { NUL, BOOLEAN, INTEGER, REAL, STRING, ARRAY, OBJECT };
+  Kind kind = NUL;
+  bool boolean = false;
+  long long integer = 0;
+  double real = 0;
+  std::string text;
+  std::vector<std::string> keys;                 // yalnızca OBJECT; items ile aynı sırada
+  std::vector<std::unique_ptr<JsonNode>> items;  // dizi elemanları ya da nesne değerleri
+
+  void reset(Kind newKind) {
+    kind = newKind; boolean = false; integer = 0; real = 0;
+    text.clear(); keys.clear(); items.clear();
+  }
+  JsonNode *member(const char *key) const {
+    if (kind != OBJECT) return NULL;
+    for (size_t i = 0; i < keys.size(); i++) {
+      if (keys[i] == key) return items[i].get();
+    }
+    return NULL;
+  }
+  JsonNode *element(size_t index) const {
+    return kind == ARRAY && index < items.size() ? items[index].get() : NULL;
+  }
+  JsonNode *append() {
+    items.push_back(std::unique_ptr<JsonNode>(new JsonNode()));
+    return items.back().get();
+  }
+};
+
+class JsonObject;
+class JsonArray;
+class JsonVariant;
+
+template <class T, class Enable = void> struct JsonConverter;
+
+class JsonVariant {
+public:
+  JsonVariant() {}
+  explicit JsonVariant(JsonNode *target) : node(target) {}
+
+  bool isNull() const { return node == NULL || node->kind == JsonNode::NUL; }
+  size_t size() const { return node != NULL && (node->kind == JsonNode::ARRAY || node->kind == JsonNode::OBJECT) ? node->items.size() : 0; }
+  bool containsKey(const char *key) const { return node != NULL && node->member(key) != NULL; }
+
+  // Yoksa yazma için yer tutan bir değişken döner; atama yapıldığında üye oluşturulur.
+  JsonVariant operator[](const char *key) const {
+    JsonVariant child(node != NULL ? node->member(key) : NULL);
+    if (child.node == NULL && node != NULL) { child.parent = node; child.key = key; }
+    return child;
+  }
+  JsonVariant operator[](int index) const { return JsonVariant(node != NULL ? node->element(index) : NULL); }
+
+  template <class T> T as() const { return JsonConverter<T>::read(node); }
+  template <class T> bool is() const { return JsonConverter<T>::matches(node); }
+  template <class T> operator T() const { return as<T>(); }
+  template <class T> T operator|(const T &fallback) const { return is<T>() ? as<T>() : fallback; }
+
+  template <class T> JsonVariant &operator=(const T &value) {
+    JsonNode *target = resolve();
+    if (target != NULL) JsonConverter<T>::write(target, value);
+    return *this;
+  }
+  JsonVariant &operator=(const char *value) {
+    JsonNode *target = resolve();
+    if (target != NULL) { target->reset(JsonNode::STRING); target->text = value; }
+    return *this;
+  }
+
+  template <class T> T to();
+  template <class T> T add();
+  template <class T> bool add(const T &value) {
+    JsonNode *target = resolve();
+    if (target == NULL) return false;
+    if (target->kind != JsonNode::ARRAY) target->reset(JsonNode::ARRAY);
+    JsonConverter<T>::write(target->append(), value);
+    return true;
+  }
+
+  JsonNode *node = NULL;
+
+protected:
+  JsonNode *resolve() {
+    if (node == NULL && parent != NULL) {
+      if (parent->kind == JsonNode::NUL) parent->reset(JsonNode::OBJECT);
+      if (parent->kind != JsonNode::OBJECT) return NULL;
+      parent->keys.push_back(key);
+      node = parent->append();
+      parent = NULL;
+    }
+    return node;
+  }
+  JsonNode *parent = NULL;
+  std::string key;
+};
+
+class JsonObject : public JsonVariant {
+public:
+  JsonObject() {}
+  explicit JsonObject(JsonNode *target) : JsonVariant(target) {}
+};
+
+class JsonArray : public JsonVariant {
+public:
+  class iterator {
+  public:
+    iterator(const JsonNode *array, size_t position) : owner(array), index(position) {}
+    JsonVariant operator*() const { return JsonVariant(owner->items[index].get()); }
+    iterator &operator++() { index++; return *this; }
+    bool operator!=(const iterator &other) const { return index != other.index; }
+  private:
+    const JsonNode *owner; size_t index;
+  };
+  JsonArray() {}
+  explicit JsonArray(JsonNode *target) : JsonVariant(target) {}
+  iterator begin() const { return iterator(node, 0); }
+  iterator end() const { return iterator(node, size()); }
+};
+
+template <class T>
+struct JsonConverter<T, typename std::enable_if<std::is_same<T, bool>::value>::type> {
+  static bool matches(const JsonNode *node) { return node != NULL && node->kind == JsonNode::BOOLEAN; }
+  static bool read(const JsonNode *node) {
+    if (node == NULL) return false;
+    if (node->kind == JsonNode::BOOLEAN) return node->boolean;
+    return node->kind == JsonNode::INTEGER ? node->integer != 0 : false;
+  }
+  static void write(JsonNode *node, bool value) { node->reset(JsonNode::BOOLEAN); node->boolean = value; }
+};
+
+// Tamsayılar ve enum'lar
+template <class T>
+struct JsonConverter<T, typename std::enable_if<(std::is_integral<T>::value && !std::is_same<T, bool>::value) || std::is_enum<T>::value>::type> {
+  static bool matches(const JsonNode *node) { return node != NULL && node->kind == JsonNode::INTEGER; }
+  static T read(const JsonNode *node) {
+    if (node == NULL) return T();
+    if (node->kind == JsonNode::INTEGER) return (T)node->integer;
+    return node->kind == JsonNode::REAL ? (T)(long long)node->real : T();
+  }
+  static void write(JsonNode *node, T value) { node->reset(JsonNode::INTEGER); node->integer = (long long)value; }
+};
+
+template <class T>
+struct JsonConverter<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static bool matches(const JsonNode *node) { return node != NULL && (node->kind == JsonNode::REAL || node->kind == JsonNode::INTEGER); }
+  static T read(const JsonNode *node) {
+    if (node == NULL) return 0;
+    return node->kind == JsonNode::REAL ? (T)node->real : node->kind == JsonNode::INTEGER ? (T)node->integer : 0;
+  }
+  static void write(JsonNode *node, T value) { node->reset(JsonNode::REAL); node->real = value; }
+};
+
+template <>
+struct JsonConverter<const char *> {
+  static bool matches(const JsonNode *node) { return node != NULL && node->kind == JsonNode::STRING; }
+  static const char *read(const JsonNode *node) { return matches(node) ? node->text.c_str() : NULL; }
+};
+
+template <>
+struct JsonConverter<JsonObject> {
+  static bool matches(const JsonNode *node) { return node != NULL && node->kind == JsonNode::OBJECT; }
+  static JsonObject read(JsonNode *node) { return JsonObject(matches(node) ? node : NULL); }
+};
+
+template <>
+struct JsonConverter<JsonArray> {
+  static bool matches(const JsonNode *node) { return node != NULL && node->kind == JsonNode::ARRAY; }
+  static JsonArray read(JsonNode *node) { return JsonArray(matches(node) ? node : NULL); }
+};
+
+template <>
+struct JsonConverter<JsonVariant> {
+  static bool matches(const JsonNode *node) { return true; }
+  static JsonVariant read(JsonNode *node) { return JsonVariant(node); }
+};
+
+template <> inline JsonObject JsonVariant::to<JsonObject>() {
+  JsonNode *target = resolve();
+  if (target != NULL) target->reset(JsonNode::OBJECT);
+  return JsonObject(target);
+}
+
+template <> inline JsonArray JsonVariant::to<JsonArray>() {
+  JsonNode *target = resolve();
+  if (target != NULL) target->reset(JsonNode::ARRAY);
+  return JsonArray(target);
+}
+
+template <> inline JsonObject JsonVariant::add<JsonObject>() {
+  JsonNode *target = resolve();
+  if (target == NULL) return JsonObject();
+  if (target->kind != JsonNode::ARRAY) target->reset(JsonNode::ARRAY);
+  JsonNode *element = target->append();
+  element->reset(JsonNode::OBJECT);
+  return JsonObject(element);
+}
+
+class JsonDocument : public JsonVariant {
+public:
+  JsonDocument() : root(new JsonNode()) { node = root.get(); }
+  JsonDocument(const JsonDocument &) = delete;
+  JsonDocument &operator=(const JsonDocument &) = delete;
+  void clear() { root->reset(JsonNode::NUL); }
+private:
+  std::unique_ptr<JsonNode> root;
+};
+
+class DeserializationError {
+public:
+  enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput };
+  DeserializationError(Code value = Ok) : code(value) {}
+  explicit operator bool() const { return code != Ok; }
+  const char *c_str() const {
+    static const char *names[] = { "Ok", "EmptyInput", "IncompleteInput", "InvalidInput" };
+    return names[code];
+  }
+  Code code;
+};
+
+// Özyinelemeli ayrıştırıcı; \uXXXX kaçışlarında yalnızca ASCII aralığı desteklenir.
+class JsonParser {
+public:
+  JsonParser(const char *text, size_t length) : at(text), end(text + length) {}
+
+  DeserializationError parse(JsonNode &root) {
+    skipSpace();
+    if (at == end) return DeserializationError::EmptyInput;
+    DeserializationError error = value(root, 0);
+    if (error) return error;
+    skipSpace();
+    return at == end ? DeserializationError::Ok : DeserializationError::InvalidInput;
+  }
+
+private:
+  void skipSpace() { while (at < end && (*at == ' ' || *at == '\t' || *at == '\n' || *at == '\r')) at++; }
+  bool literal(const char *word) {
+    size_t length = strlen(word);
+    if ((size_t)(end - at) < length || strncmp(at, word, length) != 0) return false;
+    at += length;
+    return true;
+  }
+
+  DeserializationError string(std::string &out) {
+    at++; // açılış tırnağı
+    while (at < end && *at != '"') {
+      char c = *at++;
+      if (c == '\\') {
+        if (at == end) return DeserializationError::IncompleteInput;
+        c = *at++;
+        switch (c) {
+          case 'n': c = '\n'; break;
+          case 't': c = '\t'; break;
+          case 'r': c = '\r'; break;
+          case 'b': c = '\b'; break;
+          case 'f': c = '\f'; break;
+          case 'u':
+            if (end - at < 4) return DeserializationError::IncompleteInput;
+            c = (char)strtol(std::string(at, 4).c_str(), NULL, 16);
+            at += 4;
+            break;
+          default: break; // \" \\ \/
+        }
+      }
+      out += c;
+    }
+    if (at == end) return DeserializationError::IncompleteInput;
+    at++;
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError number(JsonNode &out) {
+    const char *start = at;
+    bool real = false;
+    if (at < end && *at == '-') at++;
+    while (at < end && ((*at >= '0' && *at <= '9') || *at == '.' || *at == 'e' || *at == 'E' || *at == '+' || *at == '-')) {
+      if (*at == '.' || *at == 'e' || *at == 'E') real = true;
+      at++;
+    }
+    std::string digits(start, at);
+    if (digits.empty() || digits == "-") return DeserializationError::InvalidInput;
+    if (real) { out.reset(JsonNode::REAL); out.real = strtod(digits.c_str(), NULL); }
+    else { out.reset(JsonNode::INTEGER); out.integer = strtoll(digits.c_str(), NULL, 10); }
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError value(JsonNode &out, int depth) {
+    if (depth > 10) return DeserializationError::InvalidInput; // ArduinoJson'un iç içe sınırı
+    skipSpace();
+    if (at == end) return DeserializationError::IncompleteInput;
+    if (*at == '"') { out.reset(JsonNode::STRING); return string(out.text); }
+    if (*at == '{' || *at == '[') return container(out, depth);
+    if (literal("true")) { out.reset(JsonNode::BOOLEAN); out.boolean = true; return DeserializationError::Ok; }
+    if (literal("false")) { out.reset(JsonNode::BOOLEAN); return DeserializationError::Ok; }
+    if (literal("null")) { out.reset(JsonNode::NUL); return DeserializationError::Ok; }
+    return number(out);
+  }
+
+  DeserializationError container(JsonNode &out, int depth) {
+    bool object = *at++ == '{';
+    char close = object ? '}' : ']';
+    out.reset(object ? JsonNode::OBJECT : JsonNode::ARRAY);
+    skipSpace();
+    if (at < end && *at == close) { at++; return DeserializationError::Ok; }
+    for (;;) {
+      skipSpace();
+      if (object) {
+        if (at == end) return DeserializationError::IncompleteInput;
+        if (*at != '"') return DeserializationError::InvalidInput;
+        std::string key;
+        DeserializationError error = string(key);
+        if (error) return error;
+        skipSpace();
+        if (at == end) return DeserializationError::IncompleteInput;
+        if (*at++ != ':') return DeserializationError::InvalidInput;
+        out.keys.push_back(key);
+      }
+      DeserializationError error = value(*out.append(), depth + 1);
+      if (error) return error;
+      skipSpace();
+      if (at == end) return DeserializationError::IncompleteInput;
+      char c = *at++;
+      if (c == close) return DeserializationError::Ok;
+      if (c != ',') return DeserializationError::InvalidInput;
+    }
+  }
+
+  const char *at;
+  const char *end;
+};
+
+inline DeserializationError deserializeJson(JsonDocument &doc, const char *text, size_t length) {
+  doc.clear();
+  return JsonParser(text, length).parse(*doc.node);
+}
+
+inline DeserializationError deserializeJson(JsonDocument &doc, const String &text) {
+  return deserializeJson(doc, text.c_str(), text.length());
+}
+
+inline DeserializationError deserializeJson(JsonDocument &doc, Stream &input) {
+  std::string text;
+  for (int c = input.read(); c >= 0; c = input.read()) text += (char)c;
+  return deserializeJson(doc, text.data(), text.size());
+}
+
+inline void writeJsonNode(std::string &out, const JsonNode *node) {
+  char number[32];
+  switch (node == NULL ? JsonNode::NUL : node->kind) {
+    case JsonNode::NUL: out += "null"; break;
+    case JsonNode::BOOLEAN: out += node->boolean ? "true" : "false"; break;
+    case JsonNode::INTEGER: snprintf(number, sizeof(number), "%lld", node->integer); out += number; break;
+    case JsonNode::REAL: snprintf(number, sizeof(number), "%.9g", node->real); out += number; break;
+    case JsonNode::STRING:
+      out += '"';
+      for (char c : node->text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+      }
+      out += '"';
+      break;
+    case JsonNode::ARRAY:
+    case JsonNode::OBJECT: {
+      bool object = node->kind == JsonNode::OBJECT;
+      out += object ? '{' : '[';
+      for (size_t i = 0; i < node->items.size(); i++) {
+        if (i > 0) out += ',';
+        if (object) { out += '"'; out += node->keys[i]; out += "\":"; }
+        writeJsonNode(out, node->items[i].get());
+      }
+      out += object ? '}' : ']';
+      break;
+    }
+  }
+}
+
+inline size_t serializeJson(const JsonVariant &source, Print &out) {
+  std::string text;
+  writeJsonNode(text, source.node);
+  return out.write((const uint8_t *)text.data(), text.size());
+}
+
+inline size_t serializeJson(const JsonVariant &source, String &out) {
+  std::string text;
+  writeJsonNode(text, source.node);
+  out = String(text);
+  return text.size();
+}
+
+inline size_t measureJson(const JsonVariant &source) {
+  std::string text;
+  writeJsonNode(text, source.node);
+  return text.size();
+}
+
+#endif
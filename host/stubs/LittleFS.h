@@ -0,0 +1,69 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+// Bellekte tutulan dosya sistemi. Yazılan dosya close() ile görünür olur; rename() hedefin
+// üzerine yazar (LittleFS'teki gibi atomik).
+
+#include <map>
+#include <memory>
+#include <vector>
+#include "Arduino.h"
+
+typedef std::vector<uint8_t> HostFileData;
+
+class File : public Stream {
+public:
+  File() {}
+  File(std::shared_ptr<HostFileData> contents, std::map<std::string, HostFileData> *files, const std::string &path)
+    : data(contents), owner(files), name(path) {}
+  explicit operator bool() const { return data != nullptr; }
+  size_t size() const { return data ? data->size() : 0; }
+  size_t position() const { return offset; }
+  size_t write(const uint8_t *bytes, size_t length) override {
+    if (!data || owner == NULL) return 0; // okuma kipinde açık
+    data->insert(data->end(), bytes, bytes + length);
+    return length;
+  }
+  size_t read(uint8_t *bytes, size_t length) {
+    if (!data) return 0;
+    length = min(length, data->size() - offset);
+    memcpy(bytes, data->data() + offset, length);
+    offset += length;
+    return length;
+  }
+  int read() override {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  void close() {
+    if (data && owner != NULL) (*owner)[name] = *data;
+    data.reset();
+  }
+private:
+  std::shared_ptr<HostFileData> data;
+  std::map<std::string, HostFileData> *owner = NULL; // yalnızca yazma kipinde
+  std::string name;
+  size_t offset = 0;
+};
+
+class FS {
+public:
+  bool begin(bool formatOnFail = false) { return true; }
+  bool exists(const char *path) { return files.count(path) > 0; }
+  File open(const char *path, const char *mode = "r") {
+    if (mode[0] == 'w') return File(std::make_shared<HostFileData>(), &files, path);
+    if (!exists(path)) return File();
+    return File(std::make_shared<HostFileData>(files[path]), NULL, path);
+  }
+  bool remove(const char *path) { return files.erase(path) > 0; }
+  bool rename(const char *from, const char *to) {
+    if (!exists(from)) return false;
+    files[to] = files[from];
+    files.erase(from);
+    return true;
+  }
+  std::map<std::string, HostFileData> files; // harness doğrudan okuyup yazabilir
+};
+extern FS LittleFS;
+
+#endif
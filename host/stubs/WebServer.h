@@ -0,0 +1,79 @@
+#ifndef HOST_WEB_SERVER_H
+#define HOST_WEB_SERVER_H
+
+// Ağsız WebServer: harness isteği request() ile doğrudan ilgili işleyiciye verir,
+// yanıt (kod, gövde, akış verisi) response alanında toplanır.
+
+#include <functional>
+#include <vector>
+#include "WiFi.h"
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_POST };
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+struct HostResponse {
+  int code; const char *contentType; std::string body;
+};
+
+class WebServer {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  WebServer(int port) {}
+  void on(const char *uri, HTTPMethod method, THandlerFunction handler) { routes.push_back(Route{ uri, method, handler }); }
+  void onNotFound(THandlerFunction handler) { notFound = handler; }
+  void begin() {}
+  void handleClient() {}
+  void collectHeaders(const char **keys, size_t count) {}
+
+  // İsteği işler ve yanıt kodunu döner. Bağlantı işleyiciden sonra da açık kalabilir (/events).
+  int request(HTTPMethod method, const char *uri, const char *body = "") {
+    currentMethod = method;
+    currentBody = body;
+    response.code = 0; response.contentType = ""; response.body.clear(); // tampon kapasitesi korunur
+    if (!connection || connection.use_count() > 1) connection = std::make_shared<HostConnection>(); // /events tutuyorsa yenisi
+    connection->received.clear();
+    connection->open = true;
+    for (const Route &route : routes) {
+      if (route.uri == uri && (route.method == HTTP_ANY || route.method == method)) {
+        route.handler();
+        return response.code;
+      }
+    }
+    if (notFound) notFound();
+    return response.code;
+  }
+
+  HTTPMethod method() const { return currentMethod; }
+  String arg(const char *name) const { return strcmp(name, "plain") == 0 ? String(currentBody) : String(); }
+  bool hasArg(const char *name) const { return strcmp(name, "plain") == 0 && !currentBody.empty(); }
+  bool hasHeader(const char *name) const { return false; }
+  String header(const char *name) const { return String(); }
+  WiFiClient client() { return WiFiClient(connection); }
+
+  void send(int code, const char *contentType = "", const String &content = String()) {
+    response.code = code; response.contentType = contentType; response.body += content.c_str();
+  }
+  void send(int code, const char *contentType, const char *content) { send(code, contentType, String(content)); }
+  void send_P(int code, PGM_P contentType, PGM_P content, size_t length) {
+    response.code = code; response.contentType = contentType; response.body.append(content, length);
+  }
+  void sendHeader(const String &name, const String &value, bool first = false) {}
+  void setContentLength(size_t length) {}
+  void sendContent(const char *content, size_t length) { response.body.append(content, length); }
+  void sendContent(const String &content) { response.body += content.c_str(); }
+
+  HostResponse response;
+  std::shared_ptr<HostConnection> connection;
+
+private:
+  struct Route {
+    std::string uri; HTTPMethod method; THandlerFunction handler;
+  };
+  std::vector<Route> routes;
+  THandlerFunction notFound;
+  HTTPMethod currentMethod = HTTP_GET;
+  std::string currentBody;
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+// WiFiClient yazdıklarını paylaşılan bir tampona ekler; kopyaları aynı bağlantıyı temsil eder.
+
+#include <memory>
+#include "Arduino.h"
+
+struct HostConnection {
+  std::string received; bool open;
+};
+
+class WiFiClient : public Print {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(std::shared_ptr<HostConnection> connection) : link(connection) {}
+  bool connected() const { return link && link->open; }
+  explicit operator bool() const { return connected(); }
+  void stop() { if (link) link->open = false; }
+  void setNoDelay(bool noDelay) {}
+  size_t write(const uint8_t *data, size_t length) override {
+    if (!connected()) return 0;
+    link->received.append((const char *)data, length);
+    return length;
+  }
+  using Print::write;
+  std::shared_ptr<HostConnection> link;
+};
+
+class WiFiClass {
+public:
+  bool softAP(const char *ssid, const char *password) { return true; }
+  IPAddress softAPIP() { return IPAddress{ { 192, 168, 4, 1 } }; }
+};
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_WIFI_AP_H
+#define HOST_WIFI_AP_H
+
+#include "WiFi.h"
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+// I2C veri yolu modeli. endTransmission() işlemin veri yolunda süreceği kadar sanal saati
+// ilerletir: başlatma + adres + veri baytları (bayt başına 9 bit, ACK dahil) + durdurma.
+// Tamamlanan her işlem hostI2cObserver'a (varsa) bitiş zamanıyla bildirilir.
+
+#include "Arduino.h"
+
+#define I2C_BUFFER_LENGTH 128 // ESP32 Wire tamponu
+
+typedef void (*HostI2cObserver)(uint8_t address, const uint8_t *data, size_t length, uint64_t doneAt);
+extern HostI2cObserver hostI2cObserver;
+
+class TwoWire {
+public:
+  bool begin() { return true; }
+  bool setClock(uint32_t frequency) { clockHz = frequency; return true; }
+  uint32_t getClock() const { return clockHz; }
+  void beginTransmission(uint8_t address) { target = address; length = 0; overflow = false; }
+  size_t write(uint8_t data) {
+    if (length >= I2C_BUFFER_LENGTH) { overflow = true; return 0; }
+    buffer[length++] = data;
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+      if (write(data[i]) == 0) return i;
+    }
+    return count;
+  }
+  uint8_t endTransmission(bool sendStop = true) {
+    if (overflow) return 1; // veri çok uzun
+    uint64_t bits = 2 + 9ULL * (1 + length);
+    hostNowMicros += (bits * 1000000ULL + clockHz - 1) / clockHz;
+    if (hostI2cObserver != NULL) hostI2cObserver(target, buffer, length, hostNowMicros);
+    return 0;
+  }
+private:
+  uint32_t clockHz = 100000;
+  uint8_t target = 0;
+  uint8_t buffer[I2C_BUFFER_LENGTH];
+  size_t length = 0;
+  bool overflow = false;
+};
+extern TwoWire Wire;
+
+#endif
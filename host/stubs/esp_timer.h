@@ -0,0 +1,45 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+// esp_timer: saat sanal saattir. Zamanlayıcı yalnızca kurulduğu zamanı kaydeder;
+// uyanma zamanını harness runRhythmEngineOnce() dönüşünden bilir.
+
+#include <stdint.h>
+
+extern uint64_t hostNowMicros;
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_ERR_INVALID_STATE 0x103
+
+typedef enum { ESP_TIMER_TASK } esp_timer_dispatch_t;
+typedef struct {
+  void (*callback)(void *arg); void *arg; esp_timer_dispatch_t dispatch_method; const char *name; bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+struct esp_timer {
+  esp_timer_create_args_t args; uint64_t deadline; bool armed;
+};
+typedef struct esp_timer *esp_timer_handle_t;
+
+inline int64_t esp_timer_get_time() { return (int64_t)hostNowMicros; }
+
+inline esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *handle) {
+  *handle = new esp_timer();
+  (*handle)->args = *args;
+  return ESP_OK;
+}
+
+inline esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeoutUs) {
+  timer->deadline = hostNowMicros + timeoutUs;
+  timer->armed = true;
+  return ESP_OK;
+}
+
+inline esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+  if (!timer->armed) return ESP_ERR_INVALID_STATE;
+  timer->armed = false;
+  return ESP_OK;
+}
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef HOST_PGMSPACE_H
+#define HOST_PGMSPACE_H
+
+// Bilgisayarda flash ayrımı yok; PROGMEM Arduino.h'de boş tanımlı.
+#include "Arduino.h"
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef HOST_WEBINTERFACE_FORWARD_H
+#define HOST_WEBINTERFACE_FORWARD_H
+
+// Taslak "webinterface.h" olarak ekler; büyük/küçük harfe duyarlı dosya sistemlerinde
+// asıl WebInterface.h dosyasına yönlendirir.
+#include "../../WebInterface.h"
+
+#endif
@@ -1,6 +1,7 @@
 #include <Wire.h>
 #include <Adafruit_PWMServoDriver.h>
 #include <LittleFS.h> // DOSYA SİSTEMİ İÇİN EKLENDİ
+#include <ArduinoJson.h>
 
 #define PWM_FREQUENCY 1000
 Adafruit_PWMServoDriver pwm = Adafruit_PWMServoDriver();
@@ -8,25 +9,68 @@ Adafruit_PWMServoDriver pwm = Adafruit_PWMServoDriver();
 #define MIN_BPM 40
 #define MAX_BPM 140
 #define NUM_VALVES 16
-#define CONFIG_FILE "/settings.json" // Ayar dosyamızın adı
+#define LEGACY_CONFIG_FILE "/settings.json" // Eski JSON ayar dosyası, açılışta ikili kayda aktarılır
+#define WEB_POLL_MS 2
+#define MAX_SEGMENT_DURATION_MS 1000 // PQRST parçası ve manuel atış süresi üst sınırı
+#define MIN_PULSE_DURATION_MS 10     // manuel atış süresi alt sınırı; 0 ms atış çalınacak bir şey bırakmaz
 
 enum ControlMode { MANUAL_PWM, HEART_RHYTHM };
-enum PQRST_State { STATE_IDLE, STATE_P_WAVE, STATE_PR_SEGMENT, STATE_R_WAVE, STATE_ST_SEGMENT, STATE_T_WAVE };
+enum WaveShape { WAVE_SQUARE, WAVE_ECG, WAVE_CUSTOM }; // PQRST modunda çalınacak dalga biçimi
 
+// Varsayılan PQRST ayarları (ms ve % Maks.)
+#define DEFAULT_P_WAVE_DURATION 80
+#define DEFAULT_PR_SEGMENT_DURATION 70
+#define DEFAULT_R_WAVE_DURATION 100
+#define DEFAULT_ST_SEGMENT_DURATION 100
+#define DEFAULT_T_WAVE_DURATION 160
+#define DEFAULT_P_WAVE_PWM 40
+#define DEFAULT_R_WAVE_PWM 100
+#define DEFAULT_T_WAVE_PWM 60
+
+// Nabız geçiş gecikmesi (ms): kalpten (apikal) sonra nabzın her bölgeye varış süresi.
+// Sıra valf/bölge sırasıyla aynıdır (web/body.svg).
+#define MAX_PULSE_DELAY_MS 500
+static const uint16_t DEFAULT_PULSE_DELAYS[] = {
+  60,       // Temporal
+  40,       // Carotid
+  90, 90,   // Brachial
+  130, 130, // Radial
+  0,        // Apical
+  120, 120, // Femoral
+  170, 170, // Popliteal
+  210, 210, // Posterior Tibial
+  220, 220, // Dorsalis Pedis
+  30        // Subclavian
+};
+
+// Zaman alanları mikrosaniye cinsindendir (beatInterval, lastBeatTime, nextEventTime).
+// isPulsing: atışın dalga tablosu çalınıyor; segmentIndex: sıradaki tablo parçası.
+// pulseDelay (ms): valfin atışları ortak ritim saatinden bu kadar geride çalınır.
 struct ValveControl {
   uint8_t channel; ControlMode mode; bool state; int pwmValue; int heartRate; unsigned long beatInterval;
-  unsigned long lastBeatTime; int lastDutyCycle; bool debug; bool useDynamicPulse; unsigned int manualPulseDuration;
-  bool usePQRST; PQRST_State pqrstState; unsigned long lastPqrstEventTime; unsigned int pWaveDuration, prSegmentDuration, rWaveDuration, stSegmentDuration, tWaveDuration;
-  unsigned int pWavePwm, rWavePwm, tWavePwm;
+  uint64_t lastBeatTime; int lastDutyCycle; bool debug; bool useDynamicPulse; unsigned int manualPulseDuration;
+  bool usePQRST; uint16_t segmentIndex; uint64_t nextEventTime; unsigned int pWaveDuration, prSegmentDuration, rWaveDuration, stSegmentDuration, tWaveDuration;
+  unsigned int pWavePwm, rWavePwm, tWavePwm; bool isPulsing; WaveShape waveShape; unsigned int pulseDelay;
 };
 
 ValveControl valves[NUM_VALVES];
 void setSolenoidDuty(uint8_t channel, int dutyCycle);
 
+inline unsigned long bpmToInterval(int bpm) { return 60000000UL / constrain(bpm, MIN_BPM, MAX_BPM); }
+
 // Prototip bildirimleri
 void saveSettings();
 void loadSettings();
+void rescheduleValve(int valveIndex, bool restart);
+ValveControl defaultValveSettings(int valveIndex);
+void exportSettingsJson(JsonDocument &doc);
+bool importSettingsJson(JsonDocument &doc);
 
+#include "Metrics.h"
+#include "PwmOutput.h"
+#include "WaveformTable.h"
+#include "RhythmScheduler.h"
+#include "SettingsStore.h"
 #include "webinterface.h"
 
 void setup() {
@@ -42,157 +86,198 @@ void setup() {
 
   pwm.begin();
   pwm.setPWMFreq(PWM_FREQUENCY);
+  setupPwmOutput();
+
+  setupRhythmScheduler();
 
   // Ayarları dosyadan yükle, eğer dosya yoksa varsayılanları kullan ve dosyayı oluştur.
   loadSettings(); 
 
+  // Ritim motoru ve web sunucusu ayrı çekirdeklerde kendi görevlerinde çalışır.
+  startRhythmEngine();
   setupWebInterface();
 }
 
 void loop() {
-  handleWebRequests();
-  for (int i = 0; i < NUM_VALVES; i++) {
-    handleHeartRhythm(i);
-  }
-  delay(1);
+  // Tüm iş görevlerde yapılıyor; Arduino loop görevine gerek yok.
+  vTaskDelete(NULL);
+}
+
+ValveControl defaultValveSettings(int valveIndex) {
+  return {
+    .channel = (uint8_t)valveIndex, .mode = MANUAL_PWM, .state = false,
+    .pwmValue = 0, .heartRate = 60, .beatInterval = 1000000, .lastBeatTime = 0, .lastDutyCycle = -1, .debug = false,
+    .useDynamicPulse = true, .manualPulseDuration = 50, .usePQRST = false, .segmentIndex = 0, .nextEventTime = 0,
+    .pWaveDuration = DEFAULT_P_WAVE_DURATION, .prSegmentDuration = DEFAULT_PR_SEGMENT_DURATION, .rWaveDuration = DEFAULT_R_WAVE_DURATION,
+    .stSegmentDuration = DEFAULT_ST_SEGMENT_DURATION, .tWaveDuration = DEFAULT_T_WAVE_DURATION,
+    .pWavePwm = DEFAULT_P_WAVE_PWM, .rWavePwm = DEFAULT_R_WAVE_PWM, .tWavePwm = DEFAULT_T_WAVE_PWM,
+    .isPulsing = false, .waveShape = WAVE_SQUARE, .pulseDelay = DEFAULT_PULSE_DELAYS[valveIndex]
+  };
 }
 
+// Web görevinden çağrılır; ritim motorunun yayımladığı anlık görüntüden yalnızca
+// değişmiş valflerin kaydını yeniler ve dosyayı atomik olarak yazar.
 void saveSettings() {
-  StaticJsonDocument<8192> doc; // Dinamik yerine büyük bir Statik JSON belgesi kullanıyoruz (8KB)
-  JsonArray valvesArray = doc["valves"].to<JsonArray>();
+  static ValveControl snapshot[NUM_VALVES];
+  waitForValveCommands(); // az önce gönderilen ayarlar da kaydedilsin
+  readValveStatus(snapshot);
+
   for (int i = 0; i < NUM_VALVES; i++) {
-    JsonObject v = valvesArray.add<JsonObject>();
-    // ... (tüm atamalar aynı)
-    v["state"] = valves[i].state; v["mode"] = valves[i].mode; v["pwmValue"] = valves[i].pwmValue;
-    v["heartRate"] = valves[i].heartRate; v["useDynamicPulse"] = valves[i].useDynamicPulse;
-    v["manualPulseDuration"] = valves[i].manualPulseDuration; v["usePQRST"] = valves[i].usePQRST;
-    v["pWaveDuration"] = valves[i].pWaveDuration; v["prSegmentDuration"] = valves[i].prSegmentDuration;
-    v["rWaveDuration"] = valves[i].rWaveDuration; v["stSegmentDuration"] = valves[i].stSegmentDuration;
-    v["tWaveDuration"] = valves[i].tWaveDuration; v["pWavePwm"] = valves[i].pWavePwm;
-    v["rWavePwm"] = valves[i].rWavePwm; v["tWavePwm"] = valves[i].tWavePwm;
+    if (settingsDirtyMask & (1u << i)) encodeStoredValve(storedValves[i], snapshot[i], uploadedWaves[i]);
   }
+  settingsDirtyMask = 0;
+  settingsSavePending = false;
 
-  File configFile = LittleFS.open(CONFIG_FILE, "w");
-  if (!configFile) {
-    Serial.println("Ayar dosyasi kaydedilemedi!");
-    return;
-  }
-  if (serializeJson(doc, configFile) == 0) {
-    Serial.println("JSON dosyaya yazilamadi.");
-  } else {
+  if (writeSettingsFile()) {
     Serial.println("Ayarlar basariyla kaydedildi.");
+  } else {
+    Serial.println("Ayar dosyasi kaydedilemedi!");
   }
-  configFile.close();
 }
 
+// Yüklenen ayarlar doğrudan valves[] dizisine değil, komut kuyruğuyla ritim motoruna gönderilir.
 void loadSettings() {
-  if (LittleFS.exists(CONFIG_FILE)) {
-    File configFile = LittleFS.open(CONFIG_FILE, "r");
-    if (!configFile) {
-      Serial.println("Ayar dosyasi acilamadi!");
-      return;
+  if (readSettingsFile()) {
+    for (int i = 0; i < NUM_VALVES; i++) {
+      ValveControl loaded;
+      CustomWave wave;
+      decodeStoredValve(storedValves[i], i, loaded, wave);
+      submitCustomWave(i, wave);
+      submitValveSettings(i, loaded);
     }
-    StaticJsonDocument<8192> doc; // Okurken de büyük Statik belge kullan
+    Serial.println("Ayarlar dosyadan basariyla yuklendi.");
+    return;
+  }
+
+  if (LittleFS.exists(LEGACY_CONFIG_FILE)) {
+    Serial.println("Eski JSON ayar dosyasi ikili kayda aktariliyor.");
+    File configFile = LittleFS.open(LEGACY_CONFIG_FILE, "r");
+    JsonDocument doc;
     DeserializationError error = deserializeJson(doc, configFile);
     configFile.close();
-    if (error) {
-      Serial.print("JSON parse hatasi: ");
-      Serial.println(error.c_str());
+    if (!error && importSettingsJson(doc)) {
+      saveSettings();
+      LittleFS.remove(LEGACY_CONFIG_FILE);
       return;
     }
+    Serial.println("Eski ayar dosyasi okunamadi.");
+  }
 
-    JsonArray valvesArray = doc["valves"];
-    for (int i = 0; i < NUM_VALVES; i++) {
-      JsonObject v = valvesArray[i];
-      valves[i].state = v["state"]; valves[i].mode = v["mode"]; valves[i].pwmValue = v["pwmValue"];
-      valves[i].heartRate = v["heartRate"]; valves[i].useDynamicPulse = v["useDynamicPulse"];
-      valves[i].manualPulseDuration = v["manualPulseDuration"]; valves[i].usePQRST = v["usePQRST"];
-      valves[i].pWaveDuration = v["pWaveDuration"]; valves[i].prSegmentDuration = v["prSegmentDuration"];
-      valves[i].rWaveDuration = v["rWaveDuration"]; valves[i].stSegmentDuration = v["stSegmentDuration"];
-      valves[i].tWaveDuration = v["tWaveDuration"]; valves[i].pWavePwm = v["pWavePwm"];
-      valves[i].rWavePwm = v["rWavePwm"]; valves[i].tWavePwm = v["tWavePwm"];
-      valves[i].beatInterval = 60000 / valves[i].heartRate;
-      valves[i].channel = i;
+  Serial.println("Gecerli ayar kaydi bulunamadi. Varsayilan ayarlar kullaniliyor ve yeni dosya olusturuluyor.");
+  for (int i = 0; i < NUM_VALVES; i++) {
+    submitCustomWave(i, CustomWave{});
+    submitValveSettings(i, defaultValveSettings(i));
+  }
+  markAllSettingsDirty();
+  saveSettings(); // Varsayılanları dosyaya kaydet
+}
+
+// /viewsettings için ayarların JSON görünümü (yalnızca dışa aktarma/içe aktarma içindir).
+void exportSettingsJson(JsonDocument &doc) {
+  static ValveControl snapshot[NUM_VALVES];
+  waitForValveCommands();
+  readValveStatus(snapshot);
+
+  JsonArray valvesArray = doc["valves"].to<JsonArray>();
+  for (int i = 0; i < NUM_VALVES; i++) {
+    JsonObject v = valvesArray.add<JsonObject>();
+    const ValveControl &valve = snapshot[i];
+    v["state"] = valve.state; v["mode"] = valve.mode; v["pwmValue"] = valve.pwmValue;
+    v["heartRate"] = valve.heartRate; v["useDynamicPulse"] = valve.useDynamicPulse;
+    v["manualPulseDuration"] = valve.manualPulseDuration; v["usePQRST"] = valve.usePQRST;
+    v["pWaveDuration"] = valve.pWaveDuration; v["prSegmentDuration"] = valve.prSegmentDuration;
+    v["rWaveDuration"] = valve.rWaveDuration; v["stSegmentDuration"] = valve.stSegmentDuration;
+    v["tWaveDuration"] = valve.tWaveDuration; v["pWavePwm"] = valve.pWavePwm;
+    v["rWavePwm"] = valve.rWavePwm; v["tWavePwm"] = valve.tWavePwm; v["waveShape"] = valve.waveShape;
+    v["pulseDelay"] = valve.pulseDelay;
+    const CustomWave &wave = uploadedWaves[i];
+    if (wave.length > 0) {
+      JsonObject custom = v["customWave"].to<JsonObject>();
+      custom["sampleMs"] = wave.sampleMs;
+      JsonArray samples = custom["samples"].to<JsonArray>();
+      for (int s = 0; s < wave.length; s++) samples.add(wave.levels[s]);
     }
-    Serial.println("Ayarlar dosyadan basariyla yuklendi.");
-  } else {
-    Serial.println("Ayar dosyasi bulunamadi. Varsayilan ayarlar kullaniliyor ve yeni dosya olusturuluyor.");
-    // Varsayılan değerleri ata (setup içindeki gibi)
-    for (int i = 0; i < NUM_VALVES; i++) {
-        valves[i] = {
-          .channel = (uint8_t)i, .mode = MANUAL_PWM, .state = false,
-          .pwmValue = 0, .heartRate = 60, .beatInterval = 1000, .lastBeatTime = 0, .lastDutyCycle = -1, .debug = false,
-          .useDynamicPulse = true, .manualPulseDuration = 50, .usePQRST = false, .pqrstState = STATE_IDLE, .lastPqrstEventTime = 0,
-          .pWaveDuration = 80, .prSegmentDuration = 70, .rWaveDuration = 100, .stSegmentDuration = 100, .tWaveDuration = 160,
-          .pWavePwm = 40, .rWavePwm = 100, .tWavePwm = 60
-        };
+  }
+}
+
+// exportSettingsJson() biçimindeki ayarları doğrulayıp motora gönderir ve kaydı kirletir.
+// Dosyada olmayan valfler ve alanlar varsayılan değerlerini alır; açılışta hiçbir valf
+// motora gönderilmemiş (sıfır nabız aralıklı) kalmasın.
+bool importSettingsJson(JsonDocument &doc) {
+  JsonArray valvesArray = doc["valves"];
+  if (valvesArray.isNull()) return false;
+  for (int i = 0; i < NUM_VALVES; i++) {
+    JsonObject v = valvesArray[i]; // yoksa boş nesne; aşağıdaki | varsayılanları döner
+    ValveControl loaded = defaultValveSettings(i);
+    loaded.state = v["state"] | loaded.state; loaded.mode = (ControlMode)(v["mode"] | (int)loaded.mode);
+    loaded.pwmValue = v["pwmValue"] | loaded.pwmValue; loaded.heartRate = v["heartRate"] | loaded.heartRate;
+    loaded.useDynamicPulse = v["useDynamicPulse"] | loaded.useDynamicPulse;
+    loaded.manualPulseDuration = v["manualPulseDuration"] | loaded.manualPulseDuration; loaded.usePQRST = v["usePQRST"] | loaded.usePQRST;
+    loaded.pWaveDuration = v["pWaveDuration"] | loaded.pWaveDuration; loaded.prSegmentDuration = v["prSegmentDuration"] | loaded.prSegmentDuration;
+    loaded.rWaveDuration = v["rWaveDuration"] | loaded.rWaveDuration; loaded.stSegmentDuration = v["stSegmentDuration"] | loaded.stSegmentDuration;
+    loaded.tWaveDuration = v["tWaveDuration"] | loaded.tWaveDuration; loaded.pWavePwm = v["pWavePwm"] | loaded.pWavePwm;
+    loaded.rWavePwm = v["rWavePwm"] | loaded.rWavePwm; loaded.tWavePwm = v["tWavePwm"] | loaded.tWavePwm;
+    loaded.waveShape = (WaveShape)(v["waveShape"] | (int)WAVE_SQUARE); loaded.pulseDelay = v["pulseDelay"] | loaded.pulseDelay;
+    CustomWave wave = {};
+    JsonArray samples = v["customWave"]["samples"];
+    wave.sampleMs = v["customWave"]["sampleMs"] | 1;
+    for (JsonVariant sample : samples) {
+      if (wave.length >= CUSTOM_WAVE_MAX_SAMPLES) break;
+      wave.levels[wave.length++] = constrain(sample.as<int>(), 0, 100);
     }
-    saveSettings(); // Varsayılanları dosyaya kaydet
+    submitCustomWave(i, wave);
+    submitValveSettings(i, loaded);
+    markSettingsDirty(i);
   }
+  return true;
 }
 
-// handleHeartRhythm ve diğer fonksiyonlar öncekiyle aynı...
+// handleHeartRhythm ve setSolenoidDuty yalnızca ritim motoru görevinden çağrılır.
+// Değişiklik hemen yazılmaz; tur sonunda flushPwmOutput() ile toplu gönderilir.
 void setSolenoidDuty(uint8_t channel, int dutyCycle) {
   dutyCycle = constrain(dutyCycle, 0, 4095);
+  solenoidDutyCalls++;
   if (dutyCycle != valves[channel].lastDutyCycle) {
-    pwm.setPWM(channel, 0, dutyCycle);
+    solenoidDutyChanges++;
+    queuePwmOutput(channel, dutyCycle);
     valves[channel].lastDutyCycle = dutyCycle;
   }
 }
-void handleHeartRhythm(int valveIndex) {
-  unsigned long currentTime = millis();
+// Zamanı gelmiş (currentTime >= nextEventTime) tek bir geçişi işler ve bir sonraki
+// geçiş zamanını nextEventTime'a yazar. Valf artık zamanlanmayacaksa false döner.
+// Sonraki geçişler gerçekleşen değil planlanan zamandan hesaplanır; gecikme birikmez.
+// Atış başlangıçları ortak ritim saatinin ızgarasındadır (nextBeatTime), böylece aynı
+// nabızdaki valfler birbirine göre yalnızca pulseDelay kadar kayık kalır.
+// Atış, compileValveWaveform() ile önceden derlenmiş tablonun sırayla çalınmasıdır.
+bool handleHeartRhythm(int valveIndex, uint64_t currentTime) {
   ValveControl &valve = valves[valveIndex];
   if (!valve.state || valve.mode != HEART_RHYTHM) {
-    if (valve.pqrstState != STATE_IDLE) {
+    if (valve.isPulsing) {
         setSolenoidDuty(valve.channel, 0);
-        valve.pqrstState = STATE_IDLE;
+        valve.isPulsing = false;
     }
-    return;
+    return false;
   }
-  if (valve.usePQRST) {
-    if (valve.pqrstState == STATE_IDLE && (currentTime - valve.lastBeatTime >= valve.beatInterval)) {
-      valve.lastBeatTime = currentTime; valve.pqrstState = STATE_P_WAVE; valve.lastPqrstEventTime = currentTime;
-      int p_power = (valve.pwmValue * valve.pWavePwm) / 100;
-      setSolenoidDuty(valve.channel, p_power); 
-    }
-    switch (valve.pqrstState) {
-      case STATE_P_WAVE:
-        if (currentTime - valve.lastPqrstEventTime > valve.pWaveDuration) {
-          setSolenoidDuty(valve.channel, 0); valve.pqrstState = STATE_PR_SEGMENT; valve.lastPqrstEventTime = currentTime;
-        }
-        break;
-      case STATE_PR_SEGMENT:
-        if (currentTime - valve.lastPqrstEventTime > valve.prSegmentDuration) {
-          int r_power = (valve.pwmValue * valve.rWavePwm) / 100;
-          setSolenoidDuty(valve.channel, r_power); valve.pqrstState = STATE_R_WAVE; valve.lastPqrstEventTime = currentTime;
-        }
-        break;
-      case STATE_R_WAVE:
-        if (currentTime - valve.lastPqrstEventTime > valve.rWaveDuration) {
-          setSolenoidDuty(valve.channel, 0); valve.pqrstState = STATE_ST_SEGMENT; valve.lastPqrstEventTime = currentTime;
-        }
-        break;
-      case STATE_ST_SEGMENT:
-        if (currentTime - valve.lastPqrstEventTime > valve.stSegmentDuration) {
-          int t_power = (valve.pwmValue * valve.tWavePwm) / 100;
-          setSolenoidDuty(valve.channel, t_power); valve.pqrstState = STATE_T_WAVE; valve.lastPqrstEventTime = currentTime;
-        }
-        break;
-      case STATE_T_WAVE:
-        if (currentTime - valve.lastPqrstEventTime > valve.tWaveDuration) {
-          setSolenoidDuty(valve.channel, 0); valve.pqrstState = STATE_IDLE;
-        }
-        break;
-      case STATE_IDLE: break;
+  uint64_t eventTime = valve.nextEventTime;
+  if (!valve.isPulsing) {
+    if (currentTime - eventTime >= valve.beatInterval) {
+      eventTime = currentTime; // bir atıştan fazla geride kalındıysa kaçanları çalma; sonraki atış yine ızgarada
     }
+    valve.lastBeatTime = eventTime; valve.segmentIndex = 0; valve.isPulsing = true;
+    publishBeatEvent(valveIndex, BEAT_START, eventTime);
+  }
+  const WaveTable &table = waveTables[valveIndex];
+  if (valve.segmentIndex < table.length) {
+    const WaveSegment &segment = table.segments[valve.segmentIndex++];
+    setSolenoidDuty(valve.channel, segment.duty);
+    valve.nextEventTime = eventTime + segment.ticks * (uint64_t)WAVE_TICK_US;
   } else {
-    static unsigned long pulseStartTime[NUM_VALVES] = {0}; static bool isPulsing[NUM_VALVES] = {false};
-    unsigned long currentPulseDuration = valve.useDynamicPulse ? max(20UL, valve.beatInterval / 4) : valve.manualPulseDuration;
-    if (!isPulsing[valveIndex] && (currentTime - valve.lastBeatTime >= valve.beatInterval)) {
-      setSolenoidDuty(valve.channel, valve.pwmValue); valve.lastBeatTime = currentTime; pulseStartTime[valveIndex] = currentTime; isPulsing[valveIndex] = true;
-    }
-    if (isPulsing[valveIndex] && (currentTime - pulseStartTime[valveIndex] >= currentPulseDuration)) {
-      setSolenoidDuty(valve.channel, 0); isPulsing[valveIndex] = false;
-    }
+    // Zarf nabız aralığından uzunsa zarfın bitişinden sonraki ilk ızgara noktası beklenir.
+    // Arama atışın başlangıcından sonra yapılır; boş tabloda atış aynı anda hem başlayıp
+    // hem biteceğinden aynı ızgara noktası yeniden seçilip motor kilitlenmesin.
+    setSolenoidDuty(valve.channel, 0); valve.isPulsing = false;
+    publishBeatEvent(valveIndex, BEAT_END, eventTime);
+    valve.nextEventTime = nextBeatTime(valve, max(eventTime, valve.lastBeatTime + 1));
   }
-}
\ No newline at end of file
+  return true;
+}
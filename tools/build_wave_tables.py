@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Varsayılan PQRST zarflarını (kare ve EKG) wave_tables.h dosyasına üretir.
+
+kalp_ritm.ino içindeki DEFAULT_* değerleri ya da WaveformTable.h içindeki WAVE_*
+sabitleri değiştiğinde çalıştırın:
+
+    python3 tools/build_wave_tables.py
+
+Tablolar derleme zamanında hazır olsun diye burada üretilir; cihazda aynı zarfı kuran
+buildPqrstEnvelope() ile birebir aynı tamsayı hesabını yapar. ESP32 Arduino çekirdeği
+C++11 ile derlediğinden bu iş constexpr fonksiyonlarla yapılamıyor.
+"""
+
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(ROOT, "wave_tables.h")
+
+
+def read_defines(name):
+    with open(os.path.join(ROOT, name), encoding="utf-8") as f:
+        return {m.group(1): int(m.group(2)) for m in re.finditer(r"^#define (\w+) (\d+)\b", f.read(), re.M)}
+
+
+DEFINES = read_defines("kalp_ritm.ino")
+DEFINES.update(read_defines("WaveformTable.h"))
+MAX_SEGMENTS = DEFINES["WAVE_MAX_SEGMENTS"]
+RAMP_STEP = DEFINES["WAVE_RAMP_STEP_TICKS"]
+LEVEL_MAX = DEFINES["WAVE_LEVEL_MAX"]
+DICROTIC = DEFINES["DICROTIC_WAVE_PERCENT"]
+
+
+# Aşağıdaki fonksiyonlar WaveformTable.h'deki aynı adlı fonksiyonların kopyasıdır.
+def append_segment(table, level, ticks):
+    while ticks > 0:
+        chunk = min(ticks, 0xFFFF)
+        ticks -= chunk
+        if table:
+            last = table[-1]
+            if (last[0] == level or len(table) == MAX_SEGMENTS) and last[1] + chunk <= 0xFFFF:
+                last[1] += chunk
+                continue
+        if len(table) == MAX_SEGMENTS:
+            return
+        table.append([level, chunk])
+
+
+def smooth_bump(pos, length):
+    x = pos * 2048 // length
+    if x > 1024:
+        x = 2048 - x
+    return x * x * (3072 - 2 * x) // (1024 * 1024)
+
+
+def append_lobe(table, peak, ticks, smooth):
+    if not smooth:
+        append_segment(table, peak, ticks)
+        return
+    for start in range(0, ticks, RAMP_STEP):
+        length = min(ticks - start, RAMP_STEP)
+        if len(table) == MAX_SEGMENTS:
+            append_segment(table, 0, ticks - start)
+            return
+        append_segment(table, peak * smooth_bump(start + length // 2, ticks) // 1024, length)
+
+
+def percent_to_level(percent):
+    return min(percent, 100) * LEVEL_MAX // 100
+
+
+def build_envelope(smooth):
+    d = DEFINES
+    table = []
+    append_lobe(table, percent_to_level(d["DEFAULT_P_WAVE_PWM"]), d["DEFAULT_P_WAVE_DURATION"], smooth)
+    append_segment(table, 0, d["DEFAULT_PR_SEGMENT_DURATION"])
+    append_lobe(table, percent_to_level(d["DEFAULT_R_WAVE_PWM"]), d["DEFAULT_R_WAVE_DURATION"], smooth)
+    if smooth:
+        append_lobe(table, percent_to_level(d["DEFAULT_R_WAVE_PWM"] * DICROTIC // 100), d["DEFAULT_ST_SEGMENT_DURATION"], True)
+    else:
+        append_segment(table, 0, d["DEFAULT_ST_SEGMENT_DURATION"])
+    append_lobe(table, percent_to_level(d["DEFAULT_T_WAVE_PWM"]), d["DEFAULT_T_WAVE_DURATION"], smooth)
+    return table
+
+
+def c_table(name, table):
+    lines = []
+    for i in range(0, len(table), 8):
+        lines.append("  " + " ".join("{ %d, %d }," % (level, ticks) for level, ticks in table[i:i + 8]))
+    return "static const WaveSegment %s[] PROGMEM = {\n%s\n};\n" % (name, "\n".join(lines))
+
+
+def main():
+    square = build_envelope(False)
+    ecg = build_envelope(True)
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("#ifndef WAVE_TABLES_H\n#define WAVE_TABLES_H\n\n")
+        f.write("// Bu dosya tools/build_wave_tables.py ile üretilir; elle düzenlemeyin.\n")
+        f.write("// Varsayılan PQRST zarfları, seviye (0..WAVE_LEVEL_MAX) ve süre (WAVE_TICK_US) cinsinden.\n")
+        f.write("// WaveformTable.h içinden, WaveSegment tanımından sonra eklenir.\n\n")
+        f.write("// Kare: %d parça, %d ms\n" % (len(square), sum(t for _, t in square)))
+        f.write(c_table("DEFAULT_SQUARE_SEGMENTS", square))
+        f.write("\n// EKG: %d parça, %d ms\n" % (len(ecg), sum(t for _, t in ecg)))
+        f.write(c_table("DEFAULT_ECG_SEGMENTS", ecg))
+        f.write("\n#endif\n")
+
+
+if __name__ == "__main__":
+    main()
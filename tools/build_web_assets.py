@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""web/ altındaki arayüz dosyalarını gzip'leyip web_assets.h dosyasını üretir.
+
+web/ içindeki herhangi bir dosya değiştiğinde çalıştırın:
+
+    python3 tools/build_web_assets.py
+
+- index.html içindeki {{body.svg}} yer tutucusuna web/body.svg gömülür.
+- {{style.css}} ve {{app.js}} yer tutucuları o dosyanın ETag'i ile değiştirilir; böylece
+  CSS/JS adresleri içerikle birlikte değişir ve tarayıcıda süresiz önbelleklenebilir.
+- Çıktı deterministiktir (gzip zaman damgası 0), içerik değişmedikçe dosya değişmez.
+"""
+
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUTPUT = os.path.join(ROOT, "web_assets.h")
+
+IMMUTABLE = "public, max-age=31536000, immutable"
+REVALIDATE = "no-cache"
+
+# (adres, dosya, içerik türü, önbellek politikası, C adı)
+ASSETS = [
+    ("/style.css", "style.css", "text/css", IMMUTABLE, "STYLE_CSS"),
+    ("/app.js", "app.js", "application/javascript", IMMUTABLE, "APP_JS"),
+    ("/", "index.html", "text/html", REVALIDATE, "INDEX_HTML"),
+]
+
+
+def read(name):
+    with open(os.path.join(WEB_DIR, name), "rb") as f:
+        return f.read()
+
+
+def etag(data):
+    return hashlib.sha1(data).hexdigest()[:16]
+
+
+def c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "const uint8_t %s_GZ[] PROGMEM = {\n%s\n};\n" % (name, "\n".join(lines))
+
+
+def main():
+    tags = {}
+    blocks = []
+    entries = []
+    for path, filename, content_type, cache_control, name in ASSETS:
+        data = read(filename)
+        if filename == "index.html":
+            data = data.replace(b"{{body.svg}}", read("body.svg"))
+            for other, tag in tags.items():
+                data = data.replace(("{{%s}}" % other).encode(), tag.encode())
+        tag = etag(data)
+        tags[filename] = tag
+        compressed = gzip.compress(data, compresslevel=9, mtime=0)
+        blocks.append("// %s: %d bayt, gzip ile %d bayt\n%s" % (filename, len(data), len(compressed), c_array(name, compressed)))
+        entries.append('  { "%s", "%s", "%s", "\\"%s\\"", %s_GZ, sizeof(%s_GZ) },'
+                       % (path, content_type, cache_control, tag, name, name))
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n")
+        f.write("#include <pgmspace.h>\n\n")
+        f.write("// Bu dosya tools/build_web_assets.py ile web/ klasöründen üretilir; elle düzenlemeyin.\n")
+        f.write("// Dosyalar gzip ile sıkıştırılmış olarak flash'ta durur ve olduğu gibi gönderilir.\n\n")
+        f.write("struct WebAsset {\n")
+        f.write("  const char *path; const char *contentType; const char *cacheControl; const char *etag;\n")
+        f.write("  const uint8_t *data; size_t length;\n};\n\n")
+        f.write("\n".join(blocks))
+        f.write("\nconst WebAsset WEB_ASSETS[] = {\n%s\n};\n\n" % "\n".join(entries))
+        f.write("#endif\n")
+
+
+if __name__ == "__main__":
+    main()
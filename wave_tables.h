@@ -0,0 +1,31 @@
+#ifndef WAVE_TABLES_H
+#define WAVE_TABLES_H
+
+// Bu dosya tools/build_wave_tables.py ile üretilir; elle düzenlemeyin.
+// Varsayılan PQRST zarfları, seviye (0..WAVE_LEVEL_MAX) ve süre (WAVE_TICK_US) cinsinden.
+// WaveformTable.h içinden, WaveSegment tanımından sonra eklenir.
+
+// Kare: 5 parça, 510 ms
+static const WaveSegment DEFAULT_SQUARE_SEGMENTS[] PROGMEM = {
+  { 102, 80 }, { 0, 70 }, { 255, 100 }, { 0, 100 }, { 153, 160 },
+};
+
+// EKG: 105 parça, 510 ms
+static const WaveSegment DEFAULT_ECG_SEGMENTS[] PROGMEM = {
+  { 0, 4 }, { 6, 4 }, { 15, 4 }, { 28, 4 }, { 43, 4 }, { 58, 4 }, { 73, 4 }, { 86, 4 },
+  { 95, 4 }, { 101, 8 }, { 95, 4 }, { 86, 4 }, { 73, 4 }, { 58, 4 }, { 43, 4 }, { 28, 4 },
+  { 15, 4 }, { 6, 4 }, { 0, 78 }, { 9, 4 }, { 26, 4 }, { 48, 4 }, { 74, 4 }, { 104, 4 },
+  { 134, 4 }, { 164, 4 }, { 193, 4 }, { 217, 4 }, { 237, 4 }, { 250, 4 }, { 255, 4 }, { 250, 4 },
+  { 237, 4 }, { 218, 4 }, { 193, 4 }, { 165, 4 }, { 135, 4 }, { 104, 4 }, { 75, 4 }, { 48, 4 },
+  { 26, 4 }, { 9, 4 }, { 0, 8 }, { 1, 4 }, { 5, 4 }, { 9, 4 }, { 14, 4 }, { 20, 4 },
+  { 26, 4 }, { 32, 4 }, { 38, 4 }, { 43, 4 }, { 47, 4 }, { 50, 4 }, { 51, 4 }, { 50, 4 },
+  { 47, 4 }, { 43, 4 }, { 38, 4 }, { 33, 4 }, { 27, 4 }, { 20, 4 }, { 15, 4 }, { 9, 4 },
+  { 5, 4 }, { 1, 4 }, { 0, 8 }, { 2, 4 }, { 6, 4 }, { 12, 4 }, { 19, 4 }, { 28, 4 },
+  { 37, 4 }, { 48, 4 }, { 59, 4 }, { 70, 4 }, { 82, 4 }, { 93, 4 }, { 104, 4 }, { 114, 4 },
+  { 124, 4 }, { 133, 4 }, { 140, 4 }, { 146, 4 }, { 150, 4 }, { 152, 8 }, { 150, 4 }, { 146, 4 },
+  { 140, 4 }, { 133, 4 }, { 124, 4 }, { 115, 4 }, { 104, 4 }, { 93, 4 }, { 82, 4 }, { 70, 4 },
+  { 59, 4 }, { 48, 4 }, { 37, 4 }, { 28, 4 }, { 19, 4 }, { 12, 4 }, { 6, 4 }, { 2, 4 },
+  { 0, 4 },
+};
+
+#endif
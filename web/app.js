@@ -0,0 +1,32 @@
+const actuatorNames = [ "Temporal (Şakak)", "Carotid (Şah Damarı)", "Brachial (Kol) - Sol", "Brachial (Kol) - Sağ", "Radial (Bilek) - Sol", "Radial (Bilek) - Sağ", "Apical (Kalp)", "Femoral (Kasık) - Sol", "Femoral (Kasık) - Sağ", "Popliteal (Diz Arkası) - Sol", "Popliteal (Diz Arkası) - Sağ", "Posterior Tibial - Sol", "Posterior Tibial - Sağ", "Dorsalis Pedis - Sol", "Dorsalis Pedis - Sağ", "Subclavian (Köprücük)" ];
+
+document.addEventListener('DOMContentLoaded', function() {
+  const container = document.getElementById('actuators-container');
+  for (let i = 0; i < 16; i++) { container.insertAdjacentHTML('beforeend', createActuatorCard(i)); }
+  addEventListeners(); addSvgListeners(); fetchData(); startStatusStream();
+});
+
+// Canlı akış: sunucu yalnızca değişen alanları ve atış olaylarını gönderir.
+const actuatorState = [];
+function applyStatus(data) { data.valves.forEach((actuatorData, index) => { const id = actuatorData.id !== undefined ? actuatorData.id : index; actuatorState[id] = Object.assign(actuatorState[id] || {}, actuatorData); updateUI(id, actuatorState[id]); }); }
+function startStatusStream() {
+  if (!window.EventSource) { setInterval(fetchData, 2000); return; }
+  const source = new EventSource('/events');
+  source.addEventListener('status', e => applyStatus(JSON.parse(e.data)));
+  source.addEventListener('beat', e => JSON.parse(e.data).forEach(beat => { const point = document.getElementById(`pulse_point_${beat.id}`); if (point) point.classList.toggle('beating', beat.phase === 'start'); }));
+}
+
+function viewSettings() {
+  window.open('/viewsettings', '_blank');
+}
+
+// Diğer tüm JS fonksiyonları (addSvgListeners, createActuatorCard vb.) öncekiyle tamamen aynıdır.
+function addSvgListeners() { const points = document.querySelectorAll('.pulse-point'); points.forEach(point => { point.addEventListener('click', () => { points.forEach(p => p.classList.remove('active')); document.querySelectorAll('.actuator-panel').forEach(c => c.classList.remove('active')); point.classList.add('active'); const index = point.id.split('_')[2]; const card = document.getElementById(`actuator-${index}`); if (card) { card.classList.add('active'); card.scrollIntoView({ behavior: 'smooth', block: 'center' }); } }); }); }
+function createActuatorCard(id) { return `<div class="actuator-panel" id="actuator-${id}"><div class="actuator-header"><h2>Aktüatör ${id + 1}<br><small style="color:#6c757d;">${actuatorNames[id]}</small></h2><label class="switch"><input type="checkbox" id="actuator-switch-${id}"><span class="slider"></span></label></div><div class="control-group"><label>Mod:</label><label class="switch"><input type="checkbox" id="mode-switch-${id}"><span class="slider"></span></label><span id="mode-text-${id}"></span></div><div class="control-group"><label for="pwm-${id}">Maksimum Güç:</label><input type="range" id="pwm-${id}" min="0" max="4095" oninput="this.nextElementSibling.textContent=this.value" onchange="updateActuator(${id},'pwmValue',parseInt(this.value))"><span class="value-display" id="pwm-value-${id}">0</span></div><div id="rhythm-controls-${id}" class="sub-control"><div class="control-group"><label>Ritim Tipi:</label><label class="switch"><input type="checkbox" id="rhythm-type-switch-${id}"><span class="slider"></span></label><span id="rhythm-type-text-${id}"></span></div><div class="control-group"><label for="bpm-${id}">BPM:</label><input type="range" id="bpm-${id}" min="40" max="140" oninput="this.nextElementSibling.textContent=this.value" onchange="updateActuator(${id},'heartRate',parseInt(this.value))"><span class="value-display" id="bpm-value-${id}">60</span></div><div class="control-group"><label for="delay-${id}">Nabız Gecikmesi:</label><input type="range" id="delay-${id}" min="0" max="500" oninput="this.nextElementSibling.textContent=this.value+' ms'" onchange="updateActuator(${id},'pulseDelay',parseInt(this.value))"><span class="value-display" id="delay-value-${id}"></span></div><div id="simple-rhythm-settings-${id}" class="sub-control"><div class="control-group"><label>Atış Süresi Tipi:</label><label class="switch"><input type="checkbox" id="pulse-mode-switch-${id}"><span class="slider"></span></label><span id="pulse-mode-text-${id}"></span></div><div class="control-group"><label for="pulse-duration-${id}">Manuel Süre:</label><input type="range" id="pulse-duration-${id}" min="10" max="200" oninput="this.nextElementSibling.textContent=this.value+' ms'" onchange="updateActuator(${id},'manualPulseDuration',parseInt(this.value))"><span class="value-display" id="pulse-duration-value-${id}"></span></div></div><div id="pqrst-rhythm-settings-${id}" class="sub-control"><div class="control-group"><label for="wave-shape-${id}">Dalga Şekli:</label><select id="wave-shape-${id}" onchange="updateActuator(${id}, 'waveShape', parseInt(this.value))"><option value="0">Kare</option><option value="1">EKG (Yumuşak)</option><option value="2">Özel (Yüklenen)</option></select></div><div class="pqrst-label">Zamanlama Ayarları (ms)</div><div class="control-group"><label>P Dalgası Süre:</label><input type="range" min="0" max="200" id="p-dur-${id}" oninput="this.nextElementSibling.textContent=this.value+' ms'" onchange="updateActuator(${id}, 'pWaveDuration', parseInt(this.value))"><span class="value-display" id="p-dur-val-${id}"></span></div><div class="control-group"><label>P-R Aralığı:</label><input type="range" min="0" max="200" id="pr-dur-${id}" oninput="this.nextElementSibling.textContent=this.value+' ms'" onchange="updateActuator(${id}, 'prSegmentDuration', parseInt(this.value))"><span class="value-display" id="pr-dur-val-${id}"></span></div><div class="control-group"><label>R Dalgası Süre:</label><input type="range" min="0" max="200" id="r-dur-${id}" oninput="this.nextElementSibling.textContent=this.value+' ms'" onchange="updateActuator(${id}, 'rWaveDuration', parseInt(this.value))"><span class="value-display" id="r-dur-val-${id}"></span></div><div class="control-group"><label>S-T Aralığı:</label><input type="range" min="0" max="200" id="st-dur-${id}" oninput="this.nextElementSibling.textContent=this.value+' ms'" onchange="updateActuator(${id}, 'stSegmentDuration', parseInt(this.value))"><span class="value-display" id="st-dur-val-${id}"></span></div><div class="control-group"><label>T Dalgası Süre:</label><input type="range" min="0" max="200" id="t-dur-${id}" oninput="this.nextElementSibling.textContent=this.value+' ms'" onchange="updateActuator(${id}, 'tWaveDuration', parseInt(this.value))"><span class="value-display" id="t-dur-val-${id}"></span></div><div class="pqrst-label">Güç Ayarları (% Maks.)</div><div class="control-group"><label>P Dalgası Güç:</label><input type="range" min="0" max="100" id="p-pwm-${id}" oninput="this.nextElementSibling.textContent=this.value+'%'" onchange="updateActuator(${id}, 'pWavePwm', parseInt(this.value))"><span class="value-display" id="p-pwm-val-${id}"></span></div><div class="control-group"><label>R Dalgası Güç:</label><input type="range" min="0" max="100" id="r-pwm-${id}" oninput="this.nextElementSibling.textContent=this.value+'%'" onchange="updateActuator(${id}, 'rWavePwm', parseInt(this.value))"><span class="value-display" id="r-pwm-val-${id}"></span></div><div class="control-group"><label>T Dalgası Güç:</label><input type="range" min="0" max="100" id="t-pwm-${id}" oninput="this.nextElementSibling.textContent=this.value+'%'" onchange="updateActuator(${id}, 'tWavePwm', parseInt(this.value))"><span class="value-display" id="t-pwm-val-${id}"></span></div></div></div></div>`;}
+function addEventListeners() { for (let i = 0; i < 16; i++) { document.getElementById(`actuator-switch-${i}`).addEventListener('change', e => updateActuator(i, 'state', e.target.checked)); document.getElementById(`mode-switch-${i}`).addEventListener('change', e => { const isRhythmMode = e.target.checked; updateActuator(i, 'mode', isRhythmMode ? 'HEART_RHYTHM' : 'MANUAL_PWM'); document.getElementById(`rhythm-controls-${i}`).classList.toggle('active', isRhythmMode); }); document.getElementById(`rhythm-type-switch-${i}`).addEventListener('change', e => { const isPQRST = e.target.checked; const isRhythmMode = document.getElementById(`mode-switch-${i}`).checked; updateActuator(i, 'usePQRST', isPQRST); document.getElementById(`simple-rhythm-settings-${i}`).classList.toggle('active', isRhythmMode && !isPQRST); document.getElementById(`pqrst-rhythm-settings-${i}`).classList.toggle('active', isRhythmMode && isPQRST); }); document.getElementById(`pulse-mode-switch-${i}`).addEventListener('change', e => updateActuator(i, 'useDynamicPulse', e.target.checked)); } }
+function updateActuator(id, key, value) { const payload = { id, [key]: value }; fetch('/set', { method: 'POST', headers: { 'Content-Type': 'application/json' }, body: JSON.stringify(payload) }).catch(error => console.error('Hata:', error)); }
+function updateUI(id, data) { document.getElementById(`actuator-switch-${id}`).checked = data.state; const isRhythmMode = data.mode === 'HEART_RHYTHM'; document.getElementById(`mode-switch-${id}`).checked = isRhythmMode; document.getElementById(`mode-text-${id}`).textContent = isRhythmMode ? 'Ritim Modu' : 'Manuel Kontrol'; document.getElementById(`rhythm-controls-${id}`).classList.toggle('active', isRhythmMode); document.getElementById(`pwm-${id}`).value = data.pwmValue; document.getElementById(`pwm-value-${id}`).textContent = data.pwmValue; document.getElementById(`bpm-${id}`).value = data.heartRate; document.getElementById(`bpm-value-${id}`).textContent = data.heartRate; document.getElementById(`delay-${id}`).value = data.pulseDelay; document.getElementById(`delay-value-${id}`).textContent = data.pulseDelay + ' ms'; const isPQRST = data.usePQRST; document.getElementById(`rhythm-type-switch-${id}`).checked = isPQRST; document.getElementById(`rhythm-type-text-${id}`).textContent = isPQRST ? 'PQRST Kompleks' : 'Basit Atış'; document.getElementById(`simple-rhythm-settings-${id}`).classList.toggle('active', isRhythmMode && !isPQRST); document.getElementById(`pqrst-rhythm-settings-${id}`).classList.toggle('active', isRhythmMode && isPQRST); document.getElementById(`pulse-mode-switch-${id}`).checked = data.useDynamicPulse; document.getElementById(`pulse-mode-text-${id}`).textContent = data.useDynamicPulse ? 'Dinamik' : 'Manuel'; document.getElementById(`pulse-duration-${id}`).value = data.manualPulseDuration; document.getElementById(`pulse-duration-value-${id}`).textContent = data.manualPulseDuration + ' ms'; document.getElementById(`p-dur-${id}`).value = data.pWaveDuration; document.getElementById(`p-dur-val-${id}`).textContent = data.pWaveDuration + ' ms'; document.getElementById(`pr-dur-${id}`).value = data.prSegmentDuration; document.getElementById(`pr-dur-val-${id}`).textContent = data.prSegmentDuration + ' ms'; document.getElementById(`r-dur-${id}`).value = data.rWaveDuration; document.getElementById(`r-dur-val-${id}`).textContent = data.rWaveDuration + ' ms'; document.getElementById(`st-dur-${id}`).value = data.stSegmentDuration; document.getElementById(`st-dur-val-${id}`).textContent = data.stSegmentDuration + ' ms'; document.getElementById(`t-dur-${id}`).value = data.tWaveDuration; document.getElementById(`t-dur-val-${id}`).textContent = data.tWaveDuration + ' ms'; document.getElementById(`p-pwm-${id}`).value = data.pWavePwm; document.getElementById(`p-pwm-val-${id}`).textContent = data.pWavePwm + '%'; document.getElementById(`r-pwm-${id}`).value = data.rWavePwm; document.getElementById(`r-pwm-val-${id}`).textContent = data.rWavePwm + '%'; document.getElementById(`t-pwm-${id}`).value = data.tWavePwm; document.getElementById(`t-pwm-val-${id}`).textContent = data.tWavePwm + '%'; document.getElementById(`wave-shape-${id}`).value = data.waveShape;}
+async function fetchData() { try { const response = await fetch('/status'); if (!response.ok) throw new Error('Sunucu durumu alinamadi'); const data = await response.json(); applyStatus(data); } catch (error) { console.error('Veri alim hatasi:', error); } }
+function saveAllSettings() { if (!confirm('Mevcut ayarlar tüm aktüatörler için kalıcı olarak kaydedilsin mi?')) return; fetch('/save').then(res => res.ok ? alert('Ayarlar başarıyla kaydedildi!') : alert('Kaydetme başarısız!')); }
+function loadSavedSettings() { if (!confirm('Kaydedilmiş ayarlar yüklensin mi? Mevcut değişiklikler kaybolacak.')) return; fetch('/load').then(() => fetchData()); }
+function resetAllValves() { if (!confirm('Tüm ayarlar varsayılanlara döndürülsün mü?')) return; fetch('/reset').then(() => fetchData()); }
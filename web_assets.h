@@ -0,0 +1,467 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <pgmspace.h>
+
+// Bu dosya tools/build_web_assets.py ile web/ klasöründen üretilir; elle düzenlemeyin.
+// Dosyalar gzip ile sıkıştırılmış olarak flash'ta durur ve olduğu gibi gönderilir.
+
+struct WebAsset {
+  const char *path; const char *contentType; const char *cacheControl; const char *etag;
+  const uint8_t *data; size_t length;
+};
+
+// style.css: 3577 bayt, gzip ile 1311 bayt
+const uint8_t STYLE_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x57, 0x4d, 0x6f, 0xe3, 0x36,
+  0x10, 0xbd, 0xe7, 0x57, 0x10, 0x59, 0x14, 0x88, 0xb1, 0x96, 0x40, 0x4b, 0x56, 0x62, 0xcb, 0x28,
+  0xd0, 0xf6, 0x50, 0xb4, 0x87, 0xf6, 0xd0, 0x45, 0x81, 0x05, 0x8a, 0x1e, 0x28, 0x69, 0x64, 0xb1,
+  0xa1, 0x45, 0x95, 0xa4, 0xec, 0xb8, 0x45, 0xfe, 0x7b, 0x87, 0xd4, 0xb7, 0xe4, 0x18, 0x45, 0xb0,
+  0x8e, 0xa5, 0x70, 0xde, 0x3c, 0xce, 0xc7, 0x9b, 0xd9, 0x44, 0x66, 0x57, 0xf2, 0x2f, 0xc9, 0x65,
+  0x69, 0xbc, 0x9c, 0x9d, 0xb8, 0xb8, 0xc6, 0xc4, 0x63, 0x55, 0x25, 0xc0, 0xd3, 0x57, 0x6d, 0xe0,
+  0xb4, 0x26, 0x3f, 0x08, 0x5e, 0xbe, 0xfe, 0xc2, 0xd2, 0x2f, 0xee, 0xf9, 0x47, 0x3c, 0xb9, 0x26,
+  0x8f, 0x5f, 0xe0, 0x28, 0x81, 0xfc, 0xfe, 0xf3, 0xe3, 0x9a, 0xfc, 0x26, 0x13, 0x69, 0x24, 0xbe,
+  0xfb, 0x09, 0xc4, 0x19, 0x0c, 0x4f, 0x19, 0xf9, 0x15, 0x6a, 0xc0, 0xbf, 0x7c, 0xaf, 0x38, 0x13,
+  0x6b, 0xa2, 0x59, 0xa9, 0x3d, 0x0d, 0x8a, 0xe7, 0x07, 0x72, 0x62, 0xea, 0xc8, 0xcb, 0x98, 0xd0,
+  0x03, 0xa9, 0x58, 0x96, 0xf1, 0xf2, 0x18, 0x93, 0x4d, 0x54, 0xbd, 0x1d, 0x48, 0xc2, 0xd2, 0xd7,
+  0xa3, 0x92, 0x75, 0x99, 0x79, 0xa9, 0x14, 0x52, 0xc5, 0xe4, 0x53, 0xbe, 0xcb, 0xf7, 0x39, 0x3b,
+  0x90, 0xee, 0x39, 0xdc, 0x86, 0x6c, 0x8b, 0x96, 0xef, 0x0f, 0xc5, 0xa6, 0x23, 0xad, 0xf9, 0x3f,
+  0x80, 0x10, 0xfe, 0x4e, 0xc1, 0xe9, 0x40, 0x0c, 0xbc, 0x19, 0x8f, 0x09, 0x7e, 0x44, 0x17, 0x29,
+  0x94, 0x06, 0xd4, 0x60, 0x1d, 0xa4, 0x21, 0x44, 0xb4, 0xa3, 0xe0, 0x21, 0x69, 0x23, 0x4f, 0x31,
+  0x09, 0xa8, 0xf5, 0xfe, 0xfe, 0xe0, 0x17, 0xc0, 0x32, 0x50, 0xe8, 0xbc, 0x34, 0x4a, 0x0a, 0x8d,
+  0x0e, 0x32, 0xae, 0x2b, 0xc1, 0x30, 0x22, 0xb9, 0x00, 0x3c, 0x63, 0x3f, 0xbd, 0x8b, 0x62, 0x55,
+  0x4c, 0xec, 0xe7, 0x81, 0x1c, 0xed, 0xd7, 0x8d, 0xb3, 0xff, 0xbf, 0xa0, 0x49, 0x8d, 0x07, 0x4a,
+  0x4b, 0x1e, 0xc1, 0xd0, 0x18, 0x7f, 0x58, 0x6d, 0xe4, 0x38, 0x1a, 0x81, 0x35, 0x1d, 0xdf, 0xcd,
+  0xdd, 0xac, 0xbd, 0xc5, 0xa5, 0xe0, 0x06, 0x30, 0x58, 0x52, 0x21, 0x6c, 0x4c, 0x4a, 0x59, 0xf6,
+  0x4f, 0x9e, 0x62, 0x19, 0xaf, 0x75, 0x4c, 0x5c, 0x38, 0xd3, 0x5a, 0x69, 0x6b, 0x50, 0x49, 0xde,
+  0x84, 0xc1, 0x28, 0x4c, 0x03, 0x37, 0x5c, 0x62, 0x68, 0xe6, 0xb1, 0x26, 0xd4, 0x0f, 0xb4, 0xe3,
+  0xab, 0xd9, 0x19, 0xbc, 0xc4, 0x58, 0x86, 0x37, 0x12, 0x12, 0xec, 0xd8, 0xcb, 0x36, 0xc2, 0x83,
+  0xa4, 0x3f, 0x18, 0x17, 0xf2, 0x0c, 0xea, 0x83, 0xe3, 0x9b, 0xdd, 0x2e, 0xdc, 0x39, 0x5c, 0x21,
+  0x59, 0xf6, 0x31, 0x2e, 0xa5, 0x2f, 0x49, 0x9e, 0x3b, 0xdc, 0xee, 0xe0, 0x3d, 0x5c, 0x4a, 0x9f,
+  0xf7, 0xd9, 0xde, 0xe1, 0x2a, 0xd0, 0x60, 0x3e, 0x06, 0xce, 0xd2, 0x30, 0x6a, 0x09, 0xf7, 0x27,
+  0xef, 0x21, 0xa7, 0xbb, 0x20, 0x0c, 0x43, 0x87, 0x9c, 0x41, 0x52, 0x1f, 0x3f, 0x46, 0xce, 0xf3,
+  0x74, 0x43, 0x5f, 0xba, 0xbc, 0xe0, 0x55, 0x83, 0x28, 0xd8, 0x3b, 0x47, 0xbd, 0xe1, 0x3d, 0x47,
+  0x40, 0xd9, 0x8e, 0xba, 0x52, 0xf6, 0x4f, 0x0c, 0x0b, 0xc7, 0x16, 0x08, 0xfe, 0x76, 0xc7, 0x6f,
+  0x95, 0x5d, 0xc6, 0x15, 0xa4, 0x4d, 0xf2, 0x10, 0xa2, 0x3e, 0x95, 0xb6, 0xe4, 0xb0, 0x1a, 0x79,
+  0x66, 0x0a, 0x2c, 0x91, 0x67, 0x3a, 0xaa, 0xc2, 0xb8, 0x2d, 0xa9, 0xf7, 0x87, 0x4f, 0xfa, 0x7c,
+  0x9c, 0x40, 0xb7, 0x55, 0x87, 0x27, 0xd1, 0x67, 0x6b, 0x1c, 0xec, 0x9c, 0xed, 0x50, 0x80, 0xee,
+  0xd1, 0x35, 0x11, 0x76, 0xad, 0xc8, 0x87, 0x4e, 0x5a, 0x00, 0xe2, 0x13, 0x82, 0x76, 0x24, 0x28,
+  0xfd, 0xe6, 0x40, 0x0a, 0xe0, 0xc7, 0xc2, 0x74, 0x14, 0x46, 0x1c, 0xb7, 0x0d, 0xc5, 0xfe, 0x72,
+  0x89, 0x90, 0xe9, 0xeb, 0x92, 0xb2, 0x5f, 0xd5, 0x42, 0x83, 0xe7, 0xca, 0x16, 0xb1, 0xef, 0x96,
+  0x31, 0x13, 0x62, 0xa8, 0xdc, 0x91, 0x5d, 0x1f, 0x78, 0x59, 0xb1, 0x94, 0x1b, 0x74, 0x46, 0xfd,
+  0x97, 0xf9, 0x21, 0x3f, 0x01, 0x66, 0xf0, 0xc2, 0x36, 0x2a, 0x5c, 0x08, 0x97, 0x52, 0x4a, 0x6d,
+  0x4e, 0x34, 0xb6, 0xea, 0x2b, 0x2c, 0x5e, 0xf4, 0xf1, 0x6a, 0x5b, 0x7b, 0x8c, 0xc5, 0x30, 0x37,
+  0x67, 0x40, 0xa8, 0xde, 0xb6, 0x2b, 0xe9, 0xa9, 0xed, 0xc6, 0x77, 0xcd, 0xe9, 0x2e, 0x91, 0x4b,
+  0x75, 0xf2, 0xa4, 0xe2, 0xee, 0xfa, 0x5d, 0x88, 0xfb, 0xbf, 0xc4, 0x44, 0xa7, 0x4c, 0xc0, 0xd3,
+  0xc6, 0x0f, 0x56, 0xce, 0x1d, 0xba, 0xa8, 0x99, 0x91, 0xa8, 0x25, 0x4c, 0x65, 0xfa, 0x46, 0x56,
+  0x83, 0x26, 0xdc, 0x5d, 0x02, 0xf6, 0xf4, 0x5c, 0x1c, 0x88, 0x0d, 0x44, 0x2e, 0xe4, 0xc5, 0xbb,
+  0xc6, 0x0b, 0xa1, 0xe9, 0x34, 0x6a, 0x40, 0xbe, 0x55, 0x84, 0x47, 0xc5, 0xb3, 0x83, 0xfb, 0xf4,
+  0x50, 0xfe, 0xf1, 0x9d, 0x01, 0xaf, 0x29, 0x41, 0x94, 0x1a, 0x05, 0x15, 0x46, 0xf1, 0xc9, 0x22,
+  0x7b, 0x36, 0x8a, 0x6b, 0x5b, 0x58, 0xc8, 0xe2, 0x29, 0xdc, 0x22, 0xfa, 0x9a, 0x6c, 0x72, 0xb5,
+  0x5a, 0x75, 0x42, 0x19, 0xcd, 0xfd, 0x55, 0xac, 0x04, 0x71, 0xb3, 0x3f, 0x66, 0x32, 0xb7, 0xa9,
+  0xde, 0x88, 0x96, 0x82, 0x67, 0xd8, 0xd1, 0x00, 0x01, 0x3c, 0x2f, 0xa7, 0xc7, 0x54, 0x02, 0x77,
+  0xcd, 0xbb, 0x37, 0x4f, 0x17, 0x2c, 0x93, 0x17, 0x2c, 0x00, 0x9b, 0x36, 0xb2, 0xc5, 0x7f, 0xea,
+  0x98, 0xb0, 0x27, 0xba, 0x76, 0x3f, 0x3e, 0x8d, 0x56, 0xb7, 0x4a, 0x2a, 0xd4, 0x37, 0x88, 0x0e,
+  0x49, 0x9e, 0x02, 0x53, 0x47, 0xa1, 0xc3, 0x45, 0xfd, 0x0e, 0xd7, 0x24, 0x88, 0xa2, 0x35, 0xe2,
+  0x3c, 0xaf, 0x7a, 0x66, 0x0b, 0xa9, 0x1b, 0xc1, 0x37, 0x43, 0x62, 0xd9, 0xf9, 0x7f, 0xd5, 0xda,
+  0xf0, 0xfc, 0xea, 0xf2, 0x82, 0xf5, 0x81, 0x25, 0x81, 0xf5, 0x8c, 0xaa, 0x0b, 0xe6, 0x02, 0x50,
+  0x76, 0x3d, 0x8a, 0x91, 0x3a, 0xe9, 0xa1, 0x82, 0x66, 0x93, 0x68, 0x13, 0xcc, 0xa3, 0xde, 0x7a,
+  0x2b, 0x82, 0xf9, 0x08, 0x6d, 0x06, 0xcd, 0x68, 0x42, 0xcf, 0xe7, 0x2e, 0x2e, 0x02, 0xd0, 0xd7,
+  0xd7, 0xc6, 0x6f, 0x74, 0xb2, 0x1d, 0x6d, 0x9e, 0x4d, 0x60, 0xb5, 0xbc, 0xc3, 0x1d, 0x8e, 0x0d,
+  0x39, 0xeb, 0x68, 0x44, 0xc3, 0xdf, 0x3b, 0x16, 0x0b, 0x60, 0xc1, 0x12, 0x10, 0x71, 0xce, 0x95,
+  0x36, 0x5e, 0x5a, 0x70, 0x91, 0x8d, 0x84, 0x27, 0x18, 0x8f, 0x60, 0xd5, 0xd2, 0x73, 0xef, 0x9c,
+  0x76, 0xea, 0x42, 0xe1, 0x06, 0x33, 0xb9, 0xd1, 0x76, 0x1f, 0xd1, 0xe8, 0xe5, 0x86, 0x1b, 0x8c,
+  0x70, 0x19, 0x0b, 0x86, 0x4e, 0x64, 0xee, 0x99, 0x6b, 0x65, 0xd3, 0xdd, 0x02, 0x0b, 0xc8, 0x4d,
+  0x5b, 0x59, 0x8e, 0xef, 0xa5, 0x0d, 0x44, 0xd4, 0xe8, 0x38, 0x2f, 0xab, 0xda, 0xfc, 0x61, 0x4d,
+  0xbe, 0xc5, 0x7a, 0x3a, 0xc2, 0x9f, 0x6d, 0x63, 0x5a, 0xe0, 0x4b, 0xa3, 0xb9, 0x5d, 0x64, 0x49,
+  0xd7, 0x09, 0x67, 0x26, 0x6a, 0xf0, 0xda, 0x88, 0x4d, 0xd3, 0xe1, 0xef, 0x47, 0x53, 0xbf, 0xaf,
+  0x9a, 0x4e, 0x4b, 0x1b, 0x15, 0x19, 0x2d, 0x3b, 0xee, 0xd6, 0xcb, 0xfb, 0x4e, 0x88, 0x26, 0x52,
+  0x64, 0xcd, 0x90, 0xbf, 0x70, 0x93, 0x16, 0xe8, 0xaf, 0x92, 0x5d, 0xdd, 0x2b, 0xc0, 0xc6, 0xc6,
+  0xea, 0x1e, 0x09, 0x34, 0x2f, 0x5d, 0xbe, 0x5b, 0x9d, 0x6e, 0x3d, 0x47, 0x2e, 0xac, 0x5d, 0x0d,
+  0x04, 0x2e, 0x1a, 0x28, 0x31, 0x76, 0xeb, 0x13, 0x1d, 0x97, 0x13, 0xcf, 0x32, 0x01, 0x63, 0x4f,
+  0x2e, 0x36, 0x13, 0x3d, 0xee, 0x01, 0xe9, 0x80, 0xd6, 0x8c, 0x43, 0x8d, 0x6d, 0xee, 0x9a, 0x61,
+  0x20, 0xc7, 0x12, 0x6c, 0xfe, 0xda, 0x0a, 0xc2, 0x72, 0x1c, 0xc8, 0xca, 0x19, 0x36, 0xc9, 0xc1,
+  0x2f, 0xaa, 0xc7, 0xea, 0x3a, 0x80, 0xde, 0xdc, 0x2d, 0x53, 0xc8, 0xb6, 0x19, 0x5b, 0x08, 0x47,
+  0x73, 0xa3, 0xb1, 0x22, 0xf8, 0x5b, 0x3d, 0xe2, 0x15, 0x27, 0x80, 0xea, 0x0c, 0x1f, 0xd1, 0xeb,
+  0x1a, 0xf5, 0xf1, 0x71, 0x14, 0x24, 0x17, 0xb2, 0x6e, 0x78, 0xb8, 0x87, 0x86, 0xed, 0xb6, 0x11,
+  0xa9, 0x86, 0xe5, 0xf6, 0xf6, 0x0e, 0x3c, 0x11, 0xc2, 0x61, 0xc3, 0xb3, 0x93, 0x76, 0x41, 0x72,
+  0x2a, 0x4b, 0x56, 0x33, 0xc3, 0xb9, 0xde, 0x35, 0xb3, 0xc4, 0xa5, 0x23, 0x4e, 0x0b, 0x48, 0x5f,
+  0x21, 0x23, 0x9f, 0xc9, 0x10, 0xf3, 0x7b, 0x3b, 0xdf, 0x47, 0x66, 0x43, 0x48, 0x46, 0xc3, 0xcb,
+  0x7d, 0xb5, 0xb3, 0xe2, 0xeb, 0x53, 0x80, 0x4d, 0xde, 0x8c, 0x30, 0x5d, 0x27, 0xdd, 0x26, 0x3c,
+  0x16, 0x8a, 0x66, 0x89, 0x6d, 0x05, 0xbd, 0x6d, 0xb3, 0x89, 0xaa, 0x37, 0xaf, 0xc2, 0x61, 0x08,
+  0xc0, 0x1e, 0x52, 0xe8, 0xff, 0x37, 0xe1, 0xb9, 0x22, 0xe8, 0xc7, 0xcb, 0xc8, 0xcb, 0x20, 0xd9,
+  0xf3, 0xb5, 0xc3, 0xce, 0xef, 0xbf, 0xad, 0x96, 0x38, 0x5d, 0xe9, 0x5a, 0x6f, 0xda, 0x29, 0x73,
+  0xb1, 0x98, 0x29, 0x6b, 0x34, 0xda, 0x9a, 0x5a, 0x0a, 0x74, 0x44, 0xba, 0x79, 0xb3, 0xe0, 0xfc,
+  0xfe, 0xf0, 0xdd, 0x09, 0x32, 0xce, 0xc8, 0xd3, 0x68, 0x05, 0xdb, 0xd0, 0x00, 0xf3, 0xbf, 0x42,
+  0x1a, 0xcb, 0x6d, 0x70, 0xbe, 0xfe, 0xa1, 0x9a, 0xb8, 0x35, 0xf3, 0xce, 0x3e, 0x30, 0x09, 0xdb,
+  0x8d, 0xd9, 0xf9, 0x8e, 0xd7, 0xff, 0x0f, 0xb3, 0xd6, 0x8c, 0x14, 0xf9, 0x0d, 0x00, 0x00,
+};
+
+// app.js: 12635 bayt, gzip ile 2961 bayt
+const uint8_t APP_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x5a, 0x5b, 0x73, 0xdb, 0x36,
+  0x16, 0x7e, 0xf7, 0xaf, 0x80, 0xb5, 0x6d, 0x49, 0x4d, 0x6c, 0xd9, 0xce, 0x34, 0xed, 0xac, 0x6d,
+  0xa9, 0xa3, 0xd4, 0xd9, 0x24, 0xeb, 0x38, 0xf1, 0x5a, 0x6e, 0x3a, 0xdd, 0x4c, 0x26, 0x81, 0x48,
+  0xd8, 0x42, 0x05, 0x5e, 0x0a, 0x80, 0x72, 0x14, 0xd7, 0x7f, 0x63, 0x1f, 0xeb, 0xc7, 0x3e, 0xfb,
+  0xa5, 0x4f, 0x7e, 0x93, 0xfc, 0xbf, 0xf6, 0x00, 0x20, 0x29, 0x92, 0x92, 0x45, 0x4a, 0x4a, 0x3d,
+  0x93, 0x58, 0x12, 0x78, 0xce, 0xc1, 0x87, 0xef, 0x5c, 0x40, 0x5c, 0x9c, 0xc0, 0x17, 0x12, 0x61,
+  0x47, 0x46, 0x58, 0x06, 0xfc, 0x35, 0xf6, 0x88, 0x40, 0x4d, 0xf4, 0x0e, 0xd5, 0x4e, 0x89, 0x17,
+  0x06, 0x1c, 0x33, 0x64, 0xdf, 0xfd, 0x81, 0xfb, 0xb8, 0x5f, 0xaf, 0x6d, 0xa0, 0xda, 0x8f, 0x98,
+  0x07, 0x92, 0xba, 0xba, 0xad, 0x87, 0x0e, 0xb0, 0x87, 0xf9, 0xf8, 0x46, 0x3f, 0x79, 0xca, 0xb1,
+  0xd3, 0xa3, 0x4a, 0xfc, 0x30, 0x60, 0x75, 0xb4, 0x89, 0x3a, 0x01, 0x9b, 0xdd, 0x8e, 0xc7, 0xd7,
+  0xea, 0xc1, 0x09, 0x76, 0x75, 0xf3, 0x53, 0xca, 0x48, 0x3f, 0xa3, 0x30, 0xdd, 0x1e, 0x2b, 0xb4,
+  0x43, 0xea, 0x68, 0x3b, 0x98, 0x85, 0xba, 0xcb, 0x7f, 0x11, 0xcf, 0x00, 0x3c, 0xc4, 0x62, 0x7c,
+  0x93, 0xb5, 0x31, 0xeb, 0x49, 0x6c, 0xe5, 0x38, 0x08, 0x19, 0x95, 0x44, 0x3d, 0x3c, 0xa0, 0x9f,
+  0x51, 0x9b, 0xf7, 0x95, 0x48, 0x46, 0x77, 0x8e, 0x40, 0x6a, 0x42, 0x48, 0xc2, 0x69, 0xc0, 0xd1,
+  0x29, 0xed, 0x2a, 0xac, 0x19, 0xdd, 0xe9, 0x27, 0xb1, 0xd2, 0x41, 0xc0, 0x05, 0x66, 0x54, 0xa0,
+  0x63, 0xe2, 0xc2, 0xdf, 0x54, 0x65, 0xba, 0x3d, 0x56, 0xe8, 0x44, 0x5d, 0x87, 0xe1, 0x01, 0xc5,
+  0x3e, 0x0c, 0x63, 0xf4, 0x57, 0xc8, 0x47, 0xb7, 0xce, 0xe8, 0x16, 0xdc, 0x80, 0xde, 0xef, 0xad,
+  0xad, 0xb9, 0x81, 0x13, 0x79, 0xc4, 0x97, 0x0d, 0xec, 0xba, 0xcf, 0x06, 0xf0, 0xe5, 0x15, 0x85,
+  0xae, 0x7d, 0xc2, 0x6d, 0xeb, 0xe0, 0xcd, 0xd1, 0x8f, 0x81, 0x2f, 0x55, 0x5b, 0x80, 0x5d, 0xe2,
+  0x5a, 0x1b, 0xe8, 0x2c, 0xf2, 0x1d, 0x49, 0x03, 0xdf, 0xae, 0xa3, 0xcb, 0x35, 0x84, 0x1c, 0xed,
+  0x73, 0xf8, 0x2b, 0x31, 0x05, 0x15, 0xf0, 0x77, 0x6a, 0xee, 0x9c, 0xc8, 0x67, 0x8c, 0xa8, 0xaf,
+  0x4f, 0x87, 0x2f, 0x5d, 0xdb, 0x4a, 0x02, 0x43, 0x6c, 0xa6, 0xe2, 0x56, 0x7d, 0x0f, 0x6c, 0x9c,
+  0xc1, 0x20, 0x6d, 0x46, 0x24, 0xa2, 0xa0, 0xbe, 0xbd, 0x07, 0x1f, 0xfb, 0x68, 0xe7, 0x3b, 0xf8,
+  0x7c, 0xf4, 0x08, 0x3a, 0x99, 0x18, 0x6f, 0x50, 0x5f, 0x10, 0x2e, 0xdb, 0xee, 0xaf, 0xd8, 0x01,
+  0xab, 0x2f, 0x4e, 0x8f, 0x5e, 0xd9, 0x56, 0x97, 0x80, 0x3a, 0x21, 0xbe, 0xc2, 0xe6, 0x70, 0x82,
+  0x25, 0x69, 0xc7, 0xfd, 0x40, 0x80, 0xb9, 0x36, 0xad, 0xd7, 0xf7, 0xd0, 0x15, 0x74, 0x52, 0x1c,
+  0x9c, 0xb0, 0xe1, 0x01, 0x34, 0x76, 0x06, 0xe7, 0xb9, 0xa6, 0x33, 0x22, 0x9d, 0xde, 0x01, 0x96,
+  0x58, 0xfd, 0x10, 0x12, 0x73, 0xd9, 0x91, 0x58, 0x46, 0xa2, 0x23, 0xc1, 0xb8, 0x07, 0x8d, 0x6b,
+  0x57, 0xf0, 0x7f, 0x6d, 0x6b, 0x0b, 0xfd, 0x88, 0x7d, 0x36, 0xbe, 0x41, 0xb8, 0x3f, 0xbe, 0xb9,
+  0xbb, 0xde, 0x45, 0x22, 0xf2, 0x23, 0x27, 0x42, 0x43, 0xcc, 0xfc, 0xf1, 0xcd, 0x67, 0x07, 0x23,
+  0x97, 0x8c, 0xaf, 0xe9, 0xdd, 0x35, 0xf1, 0x11, 0x66, 0x20, 0xaa, 0xc2, 0x1b, 0x0d, 0x08, 0xc2,
+  0x52, 0xc9, 0xa3, 0x80, 0xe1, 0xa1, 0x6e, 0x03, 0x69, 0x74, 0x3e, 0xfa, 0xcb, 0x77, 0xc1, 0xdb,
+  0xbc, 0xb1, 0xe6, 0xe4, 0x92, 0x48, 0xf5, 0x4d, 0x54, 0x12, 0x81, 0xa3, 0x12, 0xe6, 0x11, 0x0e,
+  0x43, 0x36, 0x34, 0xa8, 0x6c, 0x17, 0x90, 0x2a, 0x92, 0xd4, 0x67, 0x63, 0x80, 0xd9, 0x80, 0x88,
+  0x06, 0x10, 0xf2, 0x0c, 0x32, 0xc5, 0xb6, 0x13, 0x2b, 0x6a, 0x38, 0x1b, 0x88, 0x42, 0x17, 0x9f,
+  0xea, 0xa8, 0xd9, 0x32, 0x9c, 0x42, 0x2f, 0x90, 0x7d, 0x4d, 0x94, 0x15, 0x6a, 0x40, 0xcb, 0x7a,
+  0xb3, 0x89, 0x22, 0x10, 0x3d, 0x03, 0xca, 0x5d, 0xf4, 0xc3, 0xd4, 0xf3, 0x5d, 0x63, 0x68, 0x2f,
+  0x8f, 0xf1, 0x1d, 0x75, 0xdf, 0x83, 0xb1, 0x37, 0xdd, 0x5f, 0x89, 0x03, 0x91, 0x24, 0x04, 0x3d,
+  0xf7, 0xed, 0x69, 0x89, 0xdf, 0x7f, 0x47, 0x97, 0x57, 0x1b, 0x39, 0x9b, 0x40, 0x73, 0x14, 0x02,
+  0x7c, 0xf2, 0xd3, 0x4b, 0x9b, 0xba, 0x1b, 0xd3, 0x66, 0x95, 0x03, 0xb5, 0x13, 0x53, 0x02, 0x66,
+  0xb8, 0x45, 0x07, 0x23, 0x3d, 0x43, 0xf6, 0xfa, 0x05, 0xc0, 0x0b, 0x2e, 0x1a, 0xda, 0xd9, 0x9d,
+  0x20, 0xe2, 0x0e, 0x51, 0xfc, 0x08, 0x22, 0x5f, 0x42, 0x20, 0x73, 0xa0, 0xc8, 0x4e, 0x5d, 0xbc,
+  0x81, 0x1e, 0x6f, 0x6f, 0x6f, 0x83, 0x6d, 0x4e, 0x64, 0xc4, 0x7d, 0x13, 0x28, 0x86, 0x1a, 0xa1,
+  0x35, 0x61, 0x44, 0x3e, 0xb9, 0x40, 0x19, 0x5b, 0xb6, 0xb5, 0x45, 0xd4, 0x2f, 0x61, 0x42, 0xd7,
+  0x88, 0xcd, 0xc8, 0x1c, 0xa1, 0xd1, 0x41, 0x4c, 0x12, 0x45, 0x78, 0xd6, 0x63, 0xff, 0xee, 0xbc,
+  0x79, 0xdd, 0x08, 0x31, 0x17, 0xc4, 0x26, 0x0d, 0xed, 0xbe, 0xfa, 0x7c, 0x53, 0x5d, 0x08, 0xea,
+  0xc4, 0xd0, 0xb4, 0x72, 0xea, 0x6d, 0x25, 0x96, 0x75, 0x6e, 0x18, 0x50, 0x5f, 0xce, 0xc9, 0xc7,
+  0x8f, 0x61, 0xc4, 0x04, 0xf9, 0xa0, 0xc5, 0x3e, 0x7c, 0x75, 0xa9, 0xd4, 0xc1, 0xbd, 0x57, 0x1f,
+  0x81, 0x0e, 0xc5, 0xa3, 0x6e, 0xaf, 0x1b, 0x2b, 0x0d, 0xa8, 0x1e, 0x42, 0x28, 0x44, 0x0d, 0x19,
+  0x9c, 0x9f, 0x33, 0x62, 0x40, 0x51, 0xff, 0x1c, 0x70, 0x69, 0xc5, 0xb0, 0x87, 0x05, 0x00, 0x84,
+  0xd0, 0xb1, 0xb4, 0x73, 0x2c, 0xed, 0x34, 0x95, 0x2c, 0x6b, 0x13, 0xb7, 0x0d, 0x28, 0xb9, 0xe8,
+  0x10, 0xa9, 0xf4, 0x44, 0xec, 0xb1, 0xd8, 0x59, 0x41, 0x48, 0x7c, 0x60, 0x56, 0x09, 0x88, 0x58,
+  0x00, 0x2c, 0x5b, 0x1f, 0xba, 0x90, 0x38, 0x7d, 0xcb, 0x98, 0x81, 0x8c, 0x3b, 0xa0, 0xe3, 0x6b,
+  0xa8, 0x31, 0x72, 0x74, 0xeb, 0x01, 0x13, 0x50, 0x37, 0xfc, 0xbe, 0xa0, 0xc3, 0x20, 0xce, 0x2d,
+  0xbb, 0x90, 0xcd, 0xb3, 0xea, 0x01, 0x1a, 0x74, 0x1b, 0x75, 0x04, 0xd9, 0xe6, 0x90, 0x3e, 0x1d,
+  0x32, 0x82, 0x24, 0xcc, 0x3b, 0x9e, 0x4a, 0xd1, 0x21, 0xe4, 0xa1, 0x3b, 0xbe, 0x81, 0x0c, 0x9c,
+  0xe4, 0x59, 0xb1, 0x3a, 0xe4, 0xb9, 0x15, 0x59, 0x72, 0x7f, 0x8b, 0x08, 0x1f, 0x76, 0x08, 0x83,
+  0xe8, 0x0f, 0x78, 0x9b, 0x31, 0xdb, 0x6a, 0x68, 0x7e, 0x37, 0xb5, 0xa8, 0xa2, 0xc3, 0xe8, 0xa4,
+  0xee, 0x8a, 0xdd, 0xa3, 0xfc, 0x65, 0x38, 0x9e, 0x76, 0xbc, 0xc3, 0xa8, 0xd3, 0x07, 0x1e, 0xec,
+  0x7a, 0x46, 0x2e, 0x63, 0x41, 0xb5, 0x86, 0x19, 0xdf, 0x70, 0x98, 0xaa, 0x06, 0x44, 0x17, 0x5a,
+  0x3a, 0x20, 0x96, 0xaa, 0x7c, 0xf3, 0xf0, 0x25, 0x89, 0xb6, 0x19, 0x62, 0x9f, 0x30, 0x6b, 0x12,
+  0x49, 0x8e, 0x32, 0xec, 0xcc, 0x37, 0x5c, 0x8c, 0x0b, 0x40, 0x3f, 0x79, 0xbe, 0x97, 0xd4, 0x17,
+  0x55, 0x28, 0x80, 0x25, 0x23, 0x4c, 0xdd, 0x86, 0x50, 0xf3, 0xa1, 0x6d, 0x7d, 0xb0, 0xea, 0xef,
+  0x1e, 0xbf, 0x4f, 0xa4, 0x1c, 0xe5, 0x97, 0x39, 0x71, 0x9a, 0xe2, 0xfc, 0xea, 0x52, 0x1b, 0x4c,
+  0x43, 0x54, 0x29, 0x6a, 0x9f, 0xc0, 0xe7, 0x1c, 0x28, 0xea, 0xa9, 0x70, 0x78, 0xc0, 0x18, 0x54,
+  0x80, 0xe0, 0x2d, 0xc4, 0x98, 0x7d, 0x09, 0x51, 0xdb, 0x83, 0x09, 0x31, 0xe0, 0xbb, 0x10, 0xb0,
+  0x5e, 0x10, 0xc8, 0x9e, 0x8a, 0x64, 0x16, 0x38, 0x7d, 0x68, 0x50, 0x93, 0x0b, 0xcc, 0x4d, 0xa6,
+  0xea, 0x98, 0xbf, 0xf9, 0xfa, 0x33, 0x6b, 0x9e, 0xd1, 0x48, 0x4c, 0x1d, 0x41, 0x1f, 0xf7, 0x5d,
+  0x3a, 0x40, 0x1a, 0x51, 0xb3, 0x96, 0xa7, 0xb9, 0x06, 0x45, 0x37, 0xd3, 0x06, 0x43, 0x72, 0xaf,
+  0x6a, 0xad, 0x99, 0xf2, 0x3d, 0x02, 0x53, 0x2e, 0x87, 0x87, 0xbd, 0xc7, 0xad, 0x76, 0x1f, 0x82,
+  0x1e, 0xcb, 0xd1, 0x5f, 0x1c, 0x29, 0x15, 0xf4, 0x08, 0xed, 0x5c, 0xed, 0x77, 0x79, 0x6b, 0x5f,
+  0x78, 0x98, 0x31, 0x28, 0x88, 0x10, 0xcb, 0xcd, 0x9a, 0x13, 0x30, 0x18, 0xd1, 0x3f, 0xbe, 0x73,
+  0xbe, 0x7f, 0xf2, 0xbd, 0xbb, 0x57, 0x6b, 0x7d, 0x75, 0x99, 0x7b, 0x19, 0x53, 0xc5, 0xf4, 0x6a,
+  0x7f, 0x4b, 0xab, 0xb4, 0xf6, 0xb7, 0xc0, 0xec, 0x3e, 0xc3, 0x5d, 0xc2, 0x92, 0x9e, 0xc5, 0x05,
+  0x85, 0xc2, 0x08, 0x1d, 0x52, 0x3f, 0x8c, 0x24, 0x92, 0xc3, 0x50, 0xd9, 0xec, 0x11, 0xa7, 0xdf,
+  0x0d, 0x3e, 0x15, 0x80, 0x1b, 0xd9, 0x14, 0xbf, 0x80, 0xc1, 0xa5, 0x66, 0x18, 0x35, 0xb8, 0xb7,
+  0x54, 0x2b, 0x7c, 0xe8, 0x4e, 0xe0, 0x13, 0x06, 0x99, 0x1b, 0xa9, 0x9a, 0xd8, 0xc1, 0x2d, 0x9b,
+  0xe7, 0x3c, 0x88, 0xc2, 0x5a, 0x0c, 0xa6, 0x75, 0x14, 0xb8, 0xbb, 0xa9, 0xce, 0xa2, 0xf8, 0xbc,
+  0xc0, 0x25, 0xcb, 0x60, 0xd3, 0x32, 0xa9, 0x01, 0x49, 0x3e, 0xc9, 0x54, 0x3d, 0x91, 0xac, 0x84,
+  0x5e, 0xbd, 0xcb, 0x34, 0x6b, 0xe1, 0x85, 0x97, 0xa8, 0x1f, 0x61, 0x28, 0x51, 0x5e, 0xe4, 0xa1,
+  0xe7, 0xa3, 0xdb, 0xd1, 0x9f, 0x93, 0x81, 0x65, 0x87, 0xc0, 0xb1, 0x7f, 0x4e, 0x0c, 0xfe, 0x89,
+  0x26, 0xf2, 0xa8, 0xdf, 0xac, 0x6d, 0xc3, 0x27, 0xfe, 0xd4, 0xac, 0x7d, 0xbb, 0xfd, 0xcf, 0x27,
+  0x35, 0x14, 0xf8, 0x5a, 0xad, 0x59, 0x93, 0x3d, 0x2a, 0x1a, 0x3e, 0xa0, 0x8c, 0x13, 0xa5, 0x43,
+  0xbb, 0x0c, 0x8a, 0x66, 0x43, 0x01, 0x8f, 0x5f, 0xd8, 0x9a, 0x5a, 0x06, 0xa6, 0xbb, 0x88, 0x28,
+  0x45, 0xa7, 0xa7, 0x3a, 0x69, 0xd6, 0xcc, 0x54, 0x9b, 0x84, 0xae, 0xad, 0xfb, 0xda, 0xb0, 0xa0,
+  0xdb, 0xb7, 0x4a, 0xd2, 0xda, 0xd0, 0x73, 0x0b, 0xe4, 0x89, 0x3d, 0x51, 0xaf, 0xd7, 0x0b, 0x24,
+  0xea, 0xd6, 0x4d, 0x78, 0xc5, 0x0c, 0xe1, 0x1d, 0x66, 0x82, 0xdb, 0x34, 0xc7, 0xe3, 0xde, 0x9e,
+  0xe6, 0x4d, 0xc9, 0xf1, 0xde, 0x50, 0xf6, 0xbc, 0xcd, 0x98, 0x3b, 0x91, 0x8c, 0x35, 0xf1, 0x4e,
+  0xd4, 0x4d, 0x1e, 0xd5, 0x2a, 0x44, 0xca, 0x09, 0x95, 0xd4, 0x83, 0xd7, 0xe3, 0x90, 0x2e, 0x1f,
+  0x30, 0x31, 0x20, 0xf5, 0x68, 0xa5, 0xb8, 0xc9, 0xda, 0x59, 0x35, 0x7c, 0xba, 0x61, 0x1a, 0x3e,
+  0x4f, 0x8f, 0x8f, 0x4a, 0x63, 0x66, 0x22, 0x6e, 0x62, 0xe6, 0xdb, 0x24, 0x68, 0x76, 0xd4, 0xb7,
+  0xbf, 0x2d, 0x66, 0xa0, 0x3c, 0x71, 0x79, 0x02, 0x0f, 0x96, 0x0e, 0x1a, 0x05, 0x3c, 0x17, 0x34,
+  0xdf, 0x6d, 0x2f, 0x43, 0x97, 0x4b, 0xc0, 0x62, 0x62, 0xe2, 0x35, 0xee, 0xc2, 0xdb, 0x37, 0x7a,
+  0x4e, 0x1c, 0xda, 0x87, 0x92, 0x47, 0x4b, 0xd9, 0xcb, 0x6a, 0xe7, 0x73, 0xee, 0xc9, 0xf6, 0xf2,
+  0xf4, 0x3d, 0xb2, 0x90, 0x27, 0xac, 0x0a, 0x89, 0xa7, 0xde, 0x11, 0x0e, 0x14, 0x84, 0xa5, 0x59,
+  0x34, 0x03, 0xc8, 0xf1, 0x38, 0x3b, 0xf7, 0xa0, 0x0e, 0x85, 0x8c, 0x6c, 0xc6, 0x91, 0x9a, 0xbc,
+  0x67, 0xad, 0x96, 0x82, 0x6d, 0xb3, 0x98, 0xe9, 0x8c, 0x6e, 0x39, 0x90, 0xbd, 0x62, 0x2e, 0x9a,
+  0x17, 0xa6, 0x95, 0x4b, 0x78, 0xc6, 0xcc, 0xca, 0x85, 0x5c, 0x9b, 0x72, 0x23, 0x8e, 0xd5, 0xbc,
+  0x3f, 0xa9, 0xe9, 0x7e, 0x04, 0x12, 0x7a, 0xd0, 0xe5, 0x15, 0x7d, 0x96, 0x09, 0x13, 0x68, 0x3b,
+  0x49, 0xa4, 0x3d, 0x7e, 0x80, 0x48, 0xf3, 0x00, 0x34, 0x66, 0xc7, 0x3a, 0xde, 0x62, 0x30, 0xcb,
+  0x57, 0xfb, 0xfc, 0x98, 0xe6, 0xc4, 0x5e, 0x3e, 0x02, 0xc3, 0xdf, 0xb8, 0x90, 0x5f, 0x34, 0x00,
+  0x8d, 0x9b, 0x2e, 0xf0, 0x00, 0x42, 0xa6, 0x87, 0xc3, 0x14, 0xc5, 0x01, 0x66, 0xe7, 0x18, 0xdd,
+  0xfd, 0x41, 0xfa, 0x2c, 0x13, 0x90, 0x42, 0xbf, 0xff, 0x6a, 0x28, 0x53, 0x2a, 0x65, 0x04, 0x22,
+  0x4b, 0xa9, 0x74, 0x94, 0x06, 0xbc, 0x2a, 0xde, 0x47, 0x5c, 0x10, 0x9a, 0x95, 0x8e, 0x6a, 0x50,
+  0x95, 0xa4, 0x75, 0x88, 0x39, 0xd9, 0xdf, 0x32, 0xcd, 0xc5, 0xc7, 0x3b, 0xb5, 0xd6, 0xb3, 0xc3,
+  0xe7, 0xc8, 0xfe, 0x25, 0xf2, 0xa2, 0xbb, 0x6b, 0xdc, 0xaf, 0xdf, 0x27, 0xf8, 0xb8, 0xd6, 0x1a,
+  0xfd, 0xef, 0x33, 0x8c, 0xd6, 0xfe, 0x65, 0x74, 0xdb, 0x67, 0xb0, 0x3a, 0xf0, 0x33, 0xb2, 0x5b,
+  0x66, 0x58, 0x33, 0x22, 0xdb, 0xf0, 0xad, 0x07, 0x5f, 0x6b, 0xfd, 0x17, 0x56, 0x3a, 0xb0, 0x52,
+  0xf2, 0x30, 0x6a, 0x0f, 0x31, 0x8f, 0x97, 0x4c, 0x9e, 0xa8, 0x57, 0x7d, 0x2f, 0x3b, 0x46, 0x9a,
+  0x54, 0x01, 0x6a, 0xe5, 0x91, 0x9f, 0x2b, 0xa4, 0x3a, 0xbc, 0xb5, 0xff, 0x55, 0xcc, 0x4c, 0xf8,
+  0xfe, 0x3b, 0xe3, 0x1d, 0x59, 0xe1, 0xcf, 0xe0, 0xaf, 0x49, 0xa8, 0xa3, 0x65, 0x63, 0x5d, 0x63,
+  0x86, 0x07, 0xcb, 0xd5, 0x91, 0xd6, 0xf1, 0xe6, 0x09, 0x6a, 0x73, 0xcc, 0xc6, 0x37, 0xe3, 0xeb,
+  0xf1, 0xcd, 0x32, 0xa4, 0xf1, 0x07, 0x65, 0x8d, 0x77, 0xc8, 0xb9, 0xb2, 0xf7, 0x05, 0x98, 0xe3,
+  0x2b, 0x52, 0x77, 0xb2, 0x7a, 0xc4, 0x3d, 0x28, 0x77, 0xfc, 0xcb, 0x44, 0xdc, 0xaa, 0xb4, 0x75,
+  0x36, 0x4f, 0x57, 0x8b, 0x38, 0xa8, 0x19, 0x0f, 0xc8, 0x9a, 0x90, 0x5f, 0x2c, 0xe2, 0x62, 0xe0,
+  0xcb, 0x53, 0x77, 0xba, 0x7a, 0xc4, 0x3d, 0x28, 0x77, 0xf2, 0xcb, 0x44, 0x5c, 0x75, 0xda, 0x72,
+  0x33, 0x8a, 0x5e, 0xd2, 0x66, 0x67, 0x93, 0xaf, 0x91, 0x5a, 0xee, 0x36, 0x96, 0x99, 0x52, 0xca,
+  0x97, 0xc7, 0x39, 0xba, 0x77, 0x26, 0x53, 0x4a, 0x66, 0xc9, 0xbc, 0x34, 0xdd, 0x5f, 0x57, 0x9e,
+  0x50, 0x8e, 0x2f, 0xbc, 0x55, 0xe6, 0x92, 0x78, 0x9d, 0xbc, 0x7a, 0x41, 0x5c, 0x96, 0x2f, 0xfe,
+  0x70, 0x7c, 0xf1, 0x95, 0xf9, 0xe2, 0x2b, 0xf2, 0x75, 0xba, 0x3a, 0x5f, 0xf2, 0xe1, 0xf8, 0x92,
+  0x2b, 0xf3, 0x25, 0xe7, 0xf3, 0x35, 0xf5, 0xf7, 0xe3, 0xde, 0x55, 0x6e, 0xb7, 0xbb, 0x78, 0x40,
+  0x86, 0x2e, 0xcb, 0xce, 0xe6, 0xca, 0x37, 0x6d, 0x27, 0x2b, 0xb9, 0xab, 0x8f, 0xf5, 0x59, 0x9b,
+  0xdc, 0x9a, 0x94, 0xe4, 0x7c, 0xa3, 0x40, 0x0d, 0xd5, 0xf3, 0x83, 0xde, 0x63, 0x40, 0xa4, 0x21,
+  0x31, 0x87, 0x6e, 0x1a, 0x7a, 0xd1, 0x48, 0xdc, 0xdc, 0xf6, 0x76, 0xb1, 0xfb, 0xc2, 0x22, 0xb2,
+  0x4a, 0xd7, 0xe9, 0xa1, 0x98, 0x38, 0xd1, 0x0b, 0x94, 0x23, 0x30, 0x01, 0x63, 0x2e, 0x76, 0xbb,
+  0x37, 0x0b, 0xa3, 0xea, 0x0e, 0xec, 0xe4, 0x54, 0x7f, 0x40, 0xd6, 0x8b, 0x67, 0xed, 0x93, 0xd3,
+  0x0f, 0x27, 0x2f, 0x7e, 0x39, 0x7d, 0x71, 0x64, 0xa1, 0x5d, 0x64, 0x1d, 0xb5, 0x5f, 0xff, 0xd4,
+  0x7e, 0xf5, 0xe1, 0xf8, 0xe7, 0x23, 0x6b, 0x1e, 0xfa, 0x19, 0xbb, 0x64, 0x6a, 0x04, 0xd3, 0xa7,
+  0x30, 0xf1, 0x2e, 0x77, 0xbe, 0xe7, 0x78, 0xbf, 0xba, 0xcc, 0x7a, 0x61, 0xcb, 0x6b, 0x31, 0x8a,
+  0x8e, 0xff, 0x73, 0xd2, 0x39, 0x9d, 0xc9, 0xce, 0x4c, 0x12, 0x17, 0xf1, 0xd3, 0x3c, 0x9e, 0x23,
+  0x41, 0x74, 0xcf, 0x7a, 0xc4, 0xfa, 0xdb, 0xbc, 0x81, 0xde, 0xbf, 0xe1, 0xb1, 0x00, 0x9b, 0xe8,
+  0x9b, 0x6f, 0xd0, 0x7a, 0x85, 0xce, 0xee, 0x5d, 0xdb, 0x2e, 0xd8, 0xd7, 0xa4, 0xab, 0xb9, 0x4e,
+  0x9c, 0xb9, 0x57, 0xb2, 0x64, 0x86, 0x01, 0xab, 0x07, 0x43, 0x1f, 0x7b, 0xd4, 0xd1, 0xdb, 0x03,
+  0xf7, 0xe4, 0xda, 0x55, 0xf6, 0x04, 0xa4, 0x68, 0xc5, 0xdd, 0x40, 0x7d, 0x32, 0xdc, 0x30, 0x0b,
+  0xd6, 0xcc, 0x39, 0x19, 0x1e, 0xb2, 0x00, 0xab, 0xd3, 0x9d, 0x4b, 0xa4, 0x64, 0xde, 0x81, 0xd0,
+  0xfb, 0x5d, 0x23, 0x85, 0xae, 0xe2, 0xc3, 0x76, 0xdb, 0x82, 0x15, 0xac, 0x3a, 0xe1, 0xbc, 0x44,
+  0x1e, 0x91, 0xbd, 0xc0, 0x85, 0x44, 0x39, 0x7e, 0xa3, 0x9d, 0x6c, 0x8e, 0x40, 0xc4, 0x2e, 0x3c,
+  0xb2, 0xe2, 0xba, 0xba, 0x79, 0x0a, 0x71, 0x6b, 0x81, 0x88, 0x3a, 0x53, 0xa5, 0x8e, 0x7e, 0xf3,
+  0xd9, 0xfa, 0x55, 0xc0, 0xeb, 0x0f, 0x82, 0x22, 0xda, 0x0d, 0xdc, 0xe1, 0xae, 0x39, 0x25, 0x15,
+  0x92, 0x83, 0x0b, 0xe8, 0xd9, 0xd0, 0x8e, 0x51, 0xd4, 0x81, 0xd1, 0x06, 0x28, 0x40, 0x8f, 0x84,
+  0x73, 0xa8, 0x6b, 0xea, 0x94, 0x0b, 0x60, 0x06, 0x8c, 0x34, 0x74, 0x83, 0x6d, 0xbd, 0xc0, 0x12,
+  0xef, 0xaa, 0xf1, 0xab, 0x9f, 0xf5, 0xfc, 0xa1, 0x4f, 0xee, 0x90, 0x3a, 0x3d, 0x76, 0x5f, 0xa0,
+  0xfe, 0xb9, 0x99, 0xe8, 0x56, 0x39, 0xa1, 0xce, 0xd3, 0x75, 0x71, 0xbb, 0x2f, 0x69, 0x94, 0x80,
+  0xa7, 0xbf, 0xab, 0x73, 0xd5, 0x5c, 0x31, 0xa9, 0x5e, 0xfa, 0x0a, 0xbd, 0x66, 0xfb, 0x28, 0x33,
+  0x32, 0xd9, 0x3d, 0x03, 0x13, 0x99, 0xa9, 0xad, 0x60, 0x46, 0x55, 0x3a, 0xb3, 0x15, 0x0f, 0xbf,
+  0x22, 0x53, 0xe7, 0xcc, 0x0e, 0xd9, 0xa1, 0x29, 0x60, 0xd6, 0x62, 0xa5, 0xce, 0x5d, 0xac, 0xd6,
+  0xdd, 0x9f, 0x22, 0xc9, 0xc4, 0x0d, 0xe6, 0x4c, 0xc4, 0xc5, 0x9c, 0x26, 0xa7, 0x1d, 0x25, 0xba,
+  0x99, 0x6d, 0xad, 0xa9, 0xf1, 0x57, 0xb5, 0x93, 0xee, 0xcd, 0x17, 0x31, 0xa4, 0xbb, 0xe7, 0x25,
+  0xca, 0xa5, 0x20, 0xaa, 0x18, 0xca, 0xec, 0x71, 0x4f, 0x71, 0x91, 0x6e, 0x40, 0x97, 0xea, 0x97,
+  0xf3, 0x91, 0xda, 0x42, 0x8f, 0x90, 0x5e, 0xc2, 0xec, 0x4d, 0x4d, 0x18, 0x5a, 0x30, 0x29, 0xe3,
+  0x0b, 0x4f, 0x52, 0x53, 0xc1, 0xbc, 0x88, 0x99, 0xb9, 0xe1, 0x6c, 0xf0, 0x41, 0x24, 0x9b, 0x2f,
+  0x87, 0x81, 0x9a, 0x3a, 0xfa, 0x42, 0x47, 0xf3, 0x53, 0x2c, 0xa8, 0x44, 0x66, 0xab, 0xdb, 0x5a,
+  0x6a, 0xbe, 0x71, 0x1f, 0x72, 0xc2, 0x71, 0x97, 0x9e, 0x71, 0x16, 0x9b, 0x6d, 0x66, 0xd5, 0xb3,
+  0xc2, 0x54, 0x52, 0xcd, 0xe4, 0x1c, 0xc7, 0xcc, 0x32, 0xaa, 0xbc, 0x74, 0x40, 0xd5, 0xef, 0x7e,
+  0xa6, 0xd8, 0x58, 0xa5, 0x7d, 0xe5, 0xf7, 0xe0, 0x8b, 0x89, 0x30, 0x63, 0x7f, 0xbc, 0xba, 0xc5,
+  0xd2, 0xd4, 0x98, 0x61, 0x7d, 0x92, 0x23, 0xf7, 0xf7, 0x32, 0xd9, 0x4b, 0x98, 0xca, 0xdb, 0xec,
+  0xca, 0xbf, 0xd4, 0x44, 0xba, 0x24, 0xb8, 0x27, 0x71, 0xb3, 0xc6, 0xaa, 0xe0, 0xe2, 0x73, 0x80,
+  0x15, 0x37, 0x10, 0xcb, 0xed, 0x94, 0xa1, 0x2b, 0x5a, 0xac, 0x80, 0x70, 0x0e, 0x40, 0x5e, 0x91,
+  0xb9, 0x4a, 0xd8, 0xf8, 0x82, 0xcc, 0x65, 0xb7, 0xd6, 0x8a, 0xc0, 0xa6, 0x36, 0xc2, 0xca, 0xed,
+  0x94, 0xa0, 0x9b, 0xb2, 0x58, 0x01, 0xe1, 0x1c, 0x80, 0xb2, 0x22, 0x73, 0x95, 0xb0, 0xc9, 0x45,
+  0x63, 0x6e, 0xf3, 0xfe, 0xf9, 0x3c, 0x5e, 0x38, 0x97, 0x6a, 0x57, 0x49, 0x03, 0xb0, 0xa3, 0xd0,
+  0x7c, 0x3d, 0x3f, 0xba, 0xee, 0xc5, 0xc2, 0xcb, 0xb1, 0xf0, 0x2a, 0x58, 0x78, 0x55, 0x2c, 0xf2,
+  0x7e, 0x2c, 0xb2, 0x1c, 0x8b, 0xac, 0x82, 0x45, 0x56, 0xc5, 0x52, 0x3c, 0x54, 0x2b, 0x02, 0x4a,
+  0x4f, 0xd0, 0xf6, 0xae, 0xd6, 0xb0, 0x18, 0xfa, 0x4e, 0x7a, 0x9b, 0x38, 0x7b, 0xed, 0x16, 0x5e,
+  0xab, 0x25, 0x1f, 0xa6, 0x6b, 0x08, 0x4e, 0x44, 0x08, 0x5f, 0x94, 0x11, 0x7c, 0x81, 0x61, 0x22,
+  0x4e, 0x17, 0x0d, 0xe6, 0x8a, 0x65, 0x7c, 0x19, 0x6c, 0x3d, 0x91, 0x6b, 0x04, 0xfd, 0x3a, 0x92,
+  0x3d, 0x1e, 0x5c, 0x98, 0xbb, 0x9b, 0xe6, 0xcd, 0xbe, 0x63, 0x6e, 0xe7, 0x42, 0x60, 0x46, 0x5e,
+  0x84, 0x30, 0x53, 0xf3, 0x07, 0x76, 0xe9, 0xe4, 0xae, 0x9a, 0x02, 0x98, 0x76, 0x91, 0xda, 0x52,
+  0x0b, 0x0b, 0x7d, 0x51, 0xb8, 0x78, 0xe5, 0x56, 0xad, 0x87, 0xf4, 0x5a, 0x02, 0x99, 0xc5, 0x44,
+  0xb2, 0xe6, 0xc9, 0x2c, 0x26, 0xde, 0x12, 0x4e, 0x55, 0x4f, 0x1e, 0xea, 0x81, 0x86, 0xa0, 0x93,
+  0x85, 0x45, 0x61, 0x31, 0x25, 0x80, 0x96, 0x36, 0x63, 0xd9, 0xab, 0x91, 0x66, 0x48, 0x60, 0xf0,
+  0x8c, 0x72, 0xcf, 0xb6, 0x8e, 0xc8, 0xc0, 0x89, 0x24, 0xc2, 0x66, 0xab, 0xd5, 0x5c, 0x80, 0xc4,
+  0xe9, 0x95, 0x30, 0x46, 0x38, 0xa2, 0xa3, 0x3f, 0xa9, 0x8f, 0xfa, 0x6a, 0xd7, 0xdf, 0x19, 0xdf,
+  0xa8, 0xdb, 0xc5, 0x1c, 0xf7, 0xe1, 0xf7, 0xd0, 0x25, 0x2e, 0x65, 0x02, 0x9e, 0x79, 0xf4, 0x07,
+  0xab, 0x5e, 0x4f, 0xaf, 0xba, 0xa6, 0x2c, 0x62, 0x75, 0x4d, 0xae, 0x21, 0x7b, 0xc4, 0xb7, 0xb9,
+  0xba, 0xb0, 0xdf, 0x52, 0xa3, 0x07, 0x12, 0xd5, 0xd5, 0x5f, 0xb0, 0x2c, 0x6d, 0x2b, 0xde, 0xe1,
+  0x45, 0x5d, 0x7c, 0x77, 0xad, 0x36, 0x7a, 0x87, 0x0c, 0xa7, 0x96, 0x5d, 0xba, 0x6e, 0xd5, 0x61,
+  0x16, 0x8e, 0x45, 0x0f, 0x55, 0xb3, 0xf4, 0x48, 0x2a, 0x2b, 0xc6, 0x37, 0x9f, 0xd7, 0xad, 0xc2,
+  0x52, 0x4a, 0xad, 0xc6, 0x3a, 0xd0, 0xaf, 0x3b, 0x67, 0xc8, 0x87, 0x71, 0x07, 0x1e, 0xbd, 0xbb,
+  0x4e, 0x07, 0x3e, 0x34, 0xc7, 0x9f, 0xf1, 0x70, 0x50, 0x4c, 0x4b, 0x7c, 0xd1, 0x9a, 0xf6, 0x19,
+  0xfc, 0x03, 0x2e, 0x00, 0x5b, 0x17, 0x08, 0x70, 0x70, 0xbf, 0x31, 0x6b, 0xc4, 0xaa, 0xf7, 0x64,
+  0xc4, 0xe6, 0x6a, 0x65, 0x26, 0xf8, 0xf2, 0x40, 0x81, 0x09, 0x22, 0xc1, 0x35, 0x6f, 0xf5, 0xc5,
+  0xea, 0x19, 0x28, 0x4f, 0xb5, 0x27, 0x62, 0x74, 0x03, 0xcc, 0x05, 0x1e, 0x8e, 0x6f, 0xcc, 0x6d,
+  0x6f, 0x8c, 0x5c, 0x75, 0xab, 0x7b, 0x74, 0xcb, 0x47, 0xb7, 0x4c, 0x8c, 0x6e, 0x01, 0xf2, 0xe8,
+  0x76, 0xa6, 0x0b, 0x74, 0x2f, 0xf3, 0x11, 0xfd, 0x1f, 0x8d, 0x91, 0xdc, 0xd4, 0x5b, 0x31, 0x00,
+  0x00,
+};
+
+// index.html: 6667 bayt, gzip ile 2658 bayt
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x4b, 0x6f, 0xe3, 0xd6,
+  0x15, 0x5e, 0x67, 0x7e, 0x05, 0xc3, 0x6c, 0x32, 0x00, 0x49, 0xdd, 0xf7, 0x23, 0xb0, 0xa6, 0x98,
+  0x47, 0xd2, 0x02, 0x41, 0xdb, 0xa0, 0x33, 0x0d, 0x90, 0x55, 0x40, 0x53, 0x1c, 0x9b, 0x35, 0x2d,
+  0x09, 0x24, 0xed, 0x79, 0xfc, 0x96, 0xa2, 0xf9, 0x0d, 0xd9, 0x64, 0xe5, 0x9d, 0xa7, 0xff, 0xab,
+  0xdf, 0x39, 0x97, 0x92, 0x25, 0x37, 0x75, 0x5b, 0xc0, 0xf1, 0x42, 0xba, 0xbc, 0x3c, 0xf7, 0x3c,
+  0xbf, 0xf3, 0xb8, 0xf2, 0xc9, 0xe7, 0xaf, 0xfe, 0xfc, 0xf2, 0xcd, 0x0f, 0xdf, 0x7d, 0x9d, 0x9d,
+  0x4f, 0x97, 0xfd, 0xb3, 0x27, 0x27, 0xf4, 0x95, 0xf5, 0xf5, 0xfa, 0x6c, 0x99, 0x4f, 0x43, 0x4e,
+  0x1b, 0x6d, 0xbd, 0x7a, 0xf6, 0x24, 0xcb, 0x4e, 0x2e, 0xdb, 0xa9, 0xce, 0x9a, 0xf3, 0x7a, 0x18,
+  0xdb, 0x69, 0x99, 0xff, 0xf5, 0xcd, 0x37, 0x65, 0xc8, 0x9f, 0xa5, 0xdd, 0x75, 0x7d, 0xd9, 0x2e,
+  0xf3, 0xeb, 0xae, 0x7d, 0xb7, 0xdd, 0x0c, 0x53, 0x9e, 0x35, 0x9b, 0xf5, 0xd4, 0xae, 0x41, 0xf5,
+  0xae, 0x5b, 0x4d, 0xe7, 0xcb, 0x55, 0x7b, 0xdd, 0x35, 0x6d, 0xc9, 0x0f, 0x45, 0xd6, 0xad, 0xbb,
+  0xa9, 0xab, 0xfb, 0x72, 0x6c, 0xea, 0xbe, 0x5d, 0xca, 0x4a, 0xe4, 0xcc, 0x7e, 0xea, 0xa6, 0xbe,
+  0x7d, 0xf6, 0x7c, 0x5d, 0x4f, 0x9b, 0xcb, 0xee, 0x22, 0xfb, 0x53, 0x7d, 0xfa, 0xe9, 0xe7, 0x8f,
+  0xd9, 0xeb, 0xee, 0xf2, 0xf6, 0xa6, 0xaf, 0xa7, 0xdb, 0x5f, 0x86, 0xdb, 0x9b, 0x93, 0x45, 0x22,
+  0x22, 0xf2, 0xbe, 0x5b, 0x5f, 0x64, 0x43, 0xdb, 0x2f, 0xf3, 0x71, 0xfa, 0xd0, 0xb7, 0xe3, 0x79,
+  0xdb, 0x42, 0xf0, 0xf9, 0xd0, 0xbe, 0x5d, 0xe6, 0x0b, 0xde, 0xaa, 0x9a, 0x71, 0xfc, 0xdd, 0xf5,
+  0x32, 0x78, 0x2d, 0x56, 0x41, 0xea, 0x53, 0x6b, 0x9b, 0x55, 0x3c, 0x8d, 0x64, 0xd3, 0x22, 0x19,
+  0x75, 0x72, 0xba, 0x59, 0x7d, 0x60, 0x6e, 0xe7, 0xf2, 0xbf, 0x49, 0x06, 0x05, 0x11, 0xae, 0xba,
+  0xeb, 0xac, 0xe9, 0xeb, 0x71, 0x5c, 0xe6, 0xc4, 0xa3, 0x1d, 0x4a, 0xb2, 0x75, 0xd8, 0xf4, 0x23,
+  0x5b, 0x01, 0x8a, 0xd3, 0xab, 0x69, 0xda, 0xac, 0x77, 0x44, 0x63, 0x7d, 0xdd, 0x96, 0xa7, 0xd3,
+  0x3a, 0xcf, 0x36, 0xeb, 0xa6, 0xef, 0x9a, 0x8b, 0xb4, 0xf5, 0xbc, 0xef, 0x5f, 0xb7, 0xd3, 0xd4,
+  0xad, 0xcf, 0xc6, 0x2f, 0x9f, 0xe6, 0xcf, 0x9e, 0x7f, 0xa8, 0x87, 0xbe, 0x1e, 0x3e, 0xfd, 0x9c,
+  0x7d, 0x5b, 0x7f, 0x58, 0xb5, 0xd3, 0xc9, 0x22, 0x71, 0xf9, 0x55, 0x96, 0xfd, 0xa6, 0x5e, 0xdd,
+  0x63, 0x49, 0x5b, 0xaf, 0xc1, 0x76, 0x75, 0xc8, 0x14, 0xac, 0x3e, 0xfd, 0x3c, 0xf5, 0x60, 0x7a,
+  0xc7, 0xfe, 0x87, 0xdb, 0x9b, 0x8b, 0xbe, 0x7d, 0x90, 0xfd, 0xd0, 0x22, 0xbe, 0xf7, 0xf8, 0xf3,
+  0x1e, 0x74, 0xfe, 0xbe, 0xee, 0xaf, 0x5b, 0x66, 0xfe, 0x3d, 0x60, 0x40, 0xfc, 0x81, 0x94, 0x1d,
+  0xfb, 0x3a, 0x7b, 0x75, 0xfb, 0xcb, 0xfa, 0x41, 0xde, 0xab, 0xf6, 0xf4, 0xea, 0xec, 0x1e, 0x6f,
+  0x42, 0xcd, 0x3d, 0xb5, 0x57, 0xd0, 0xf4, 0xf7, 0xec, 0xf7, 0xf5, 0x84, 0x18, 0x1c, 0xe9, 0x7b,
+  0xb2, 0x40, 0x08, 0xee, 0x87, 0xe2, 0xb2, 0xee, 0xd6, 0x1c, 0x08, 0x7c, 0xb7, 0xc3, 0x2e, 0x12,
+  0x44, 0xd0, 0xad, 0xe0, 0xf0, 0xeb, 0xb3, 0xc3, 0x97, 0x27, 0x78, 0xce, 0xde, 0x76, 0x3d, 0xa0,
+  0xf3, 0x45, 0xc3, 0x7f, 0x79, 0x76, 0xdd, 0x0e, 0x63, 0xb7, 0x59, 0x2f, 0x73, 0x59, 0xc9, 0x9c,
+  0x0f, 0xfd, 0xe1, 0xea, 0xb2, 0x5e, 0xbf, 0x00, 0x3e, 0xf2, 0xec, 0xfd, 0x65, 0xbf, 0xa6, 0x78,
+  0x4f, 0xd3, 0xf6, 0xab, 0xc5, 0xe2, 0xdd, 0xbb, 0x77, 0xd5, 0x3b, 0x5d, 0x6d, 0x86, 0xb3, 0x85,
+  0x12, 0x42, 0x2c, 0xc0, 0x6d, 0x26, 0xf9, 0xea, 0x3d, 0x81, 0xf2, 0xd7, 0x08, 0x65, 0x8c, 0x71,
+  0xc1, 0x6f, 0xf3, 0xec, 0xc9, 0x67, 0x59, 0xca, 0x8a, 0x3c, 0x08, 0xb1, 0x7d, 0x0f, 0xcc, 0xb6,
+  0xdd, 0xd9, 0xf9, 0xb4, 0x7f, 0x24, 0x7f, 0xbc, 0xd8, 0xbc, 0x5f, 0xe6, 0x22, 0x13, 0x99, 0x12,
+  0xae, 0xd2, 0xca, 0xed, 0xbe, 0x59, 0xd0, 0x57, 0xe3, 0xb6, 0x6e, 0x90, 0x6e, 0x5b, 0x8a, 0xca,
+  0x70, 0xdd, 0x12, 0xa0, 0xcf, 0x9e, 0x3d, 0xf9, 0xec, 0xe4, 0xf3, 0xb2, 0x04, 0x6a, 0x3f, 0x76,
+  0xeb, 0xec, 0x0c, 0x81, 0x00, 0x36, 0x57, 0xdd, 0xa7, 0x9f, 0x90, 0x6d, 0x1f, 0xb3, 0x7a, 0x5d,
+  0x67, 0xd7, 0xb7, 0x37, 0xcd, 0xd5, 0x94, 0x8d, 0x5d, 0x7f, 0x7b, 0xd3, 0x4e, 0x5d, 0x56, 0x96,
+  0x74, 0x66, 0x5b, 0x4f, 0xe7, 0x19, 0xcc, 0xfd, 0xa3, 0x14, 0xa6, 0x52, 0xce, 0x16, 0x52, 0xfa,
+  0x2a, 0xda, 0xd8, 0x94, 0xa2, 0xd2, 0xc2, 0x14, 0xba, 0xb2, 0xa1, 0x50, 0x95, 0x54, 0xae, 0x50,
+  0xaa, 0xb2, 0x2a, 0x62, 0x47, 0x63, 0x27, 0x32, 0x91, 0xa8, 0x6c, 0xf4, 0x44, 0xa3, 0x40, 0xa3,
+  0xb4, 0x29, 0x62, 0xa5, 0x2c, 0x78, 0x54, 0xce, 0xe0, 0x53, 0x55, 0x3a, 0x23, 0x3e, 0xc1, 0xc8,
+  0x02, 0xcc, 0x8d, 0x29, 0x91, 0xec, 0x81, 0x88, 0xbc, 0x76, 0xd8, 0x77, 0x4a, 0x12, 0x51, 0xd4,
+  0x06, 0x8c, 0x54, 0x54, 0x38, 0x17, 0x0d, 0x7d, 0x2a, 0x89, 0x17, 0x38, 0x17, 0x23, 0xa8, 0xa0,
+  0x58, 0x21, 0x4d, 0x25, 0xbd, 0x25, 0x5e, 0x2e, 0x04, 0x10, 0x78, 0x19, 0x4a, 0x22, 0x8e, 0x44,
+  0x66, 0x95, 0x3a, 0x7a, 0x80, 0x4c, 0x5d, 0xa9, 0x60, 0x8b, 0x00, 0xa6, 0x24, 0xd3, 0x68, 0x59,
+  0xf8, 0x2a, 0x04, 0x77, 0xb8, 0x6e, 0xa0, 0x8b, 0xf4, 0x24, 0xcc, 0x90, 0x81, 0xde, 0xc6, 0x42,
+  0x54, 0x22, 0x1e, 0xad, 0x41, 0xa3, 0x95, 0x2f, 0xc8, 0x02, 0x47, 0x06, 0x1a, 0xd2, 0x5a, 0x09,
+  0x79, 0xb8, 0xce, 0x40, 0x24, 0x35, 0x1d, 0x88, 0x46, 0xe3, 0x85, 0x71, 0x9e, 0x94, 0x96, 0xee,
+  0x70, 0xdd, 0x24, 0xc1, 0xa2, 0xf2, 0x4c, 0xe3, 0x6d, 0x60, 0xf3, 0xfd, 0xe1, 0x1a, 0x3e, 0x08,
+  0x4a, 0x81, 0xc6, 0x48, 0x18, 0x5c, 0x09, 0xa5, 0xd9, 0xf8, 0x78, 0xb8, 0xce, 0x1a, 0x62, 0x4a,
+  0x92, 0xa5, 0x25, 0x0f, 0x68, 0xef, 0xca, 0x50, 0x09, 0x7b, 0xb0, 0x24, 0x27, 0x45, 0x55, 0x7a,
+  0x78, 0x3a, 0x90, 0x52, 0x52, 0x97, 0x12, 0x1c, 0xb4, 0x3e, 0x7a, 0x68, 0x5c, 0x25, 0x04, 0x7c,
+  0x03, 0x57, 0x08, 0x5b, 0x00, 0x5b, 0x22, 0x96, 0x14, 0x5f, 0x8d, 0x60, 0x46, 0x5a, 0x23, 0x90,
+  0x86, 0x83, 0xe7, 0x3c, 0xb9, 0x2d, 0x6a, 0xcf, 0x81, 0xf4, 0x25, 0x34, 0xc6, 0x41, 0x38, 0x1a,
+  0x21, 0x44, 0xe0, 0x8d, 0x85, 0xde, 0x5e, 0x46, 0x8e, 0x00, 0x59, 0x28, 0xa3, 0x2d, 0x11, 0x60,
+  0x43, 0x61, 0x12, 0x1e, 0x91, 0x51, 0x38, 0x46, 0x9e, 0x74, 0xd0, 0xca, 0x56, 0xd1, 0x33, 0x82,
+  0x9c, 0x2c, 0x15, 0xfc, 0x86, 0x68, 0x03, 0x18, 0x1a, 0x0f, 0x88, 0x95, 0xf4, 0xec, 0x4b, 0x17,
+  0x71, 0xde, 0xea, 0x12, 0x21, 0x37, 0x92, 0x94, 0xd2, 0x22, 0x1c, 0x3d, 0x34, 0x25, 0x51, 0x69,
+  0x30, 0x23, 0x6f, 0x59, 0xa3, 0x4a, 0xa5, 0x2b, 0xcf, 0x71, 0xba, 0x7b, 0x80, 0xa3, 0x74, 0x90,
+  0x10, 0xe5, 0x61, 0x1f, 0xc2, 0xc5, 0xe0, 0x50, 0xe6, 0x68, 0xcd, 0xf6, 0x69, 0x1f, 0x60, 0x7f,
+  0x40, 0xc8, 0x2d, 0x8e, 0x03, 0x77, 0xbe, 0xd2, 0x50, 0xeb, 0xf0, 0xa1, 0x21, 0x13, 0x0c, 0x34,
+  0xd5, 0x5a, 0x91, 0x7f, 0x00, 0xdb, 0x50, 0x19, 0x73, 0xb7, 0xf6, 0x06, 0xd1, 0x4b, 0x50, 0x22,
+  0x50, 0x78, 0x4d, 0x56, 0xb9, 0x78, 0xb8, 0xee, 0x53, 0x2c, 0x55, 0xe5, 0x34, 0x20, 0x03, 0x74,
+  0x19, 0x82, 0x8c, 0x23, 0xa5, 0x0d, 0xe5, 0x16, 0x1c, 0x43, 0x6b, 0x8d, 0x0c, 0x34, 0x80, 0x9e,
+  0x22, 0xd5, 0x0c, 0x84, 0x42, 0x35, 0x47, 0x66, 0x3a, 0x20, 0x10, 0x3a, 0x79, 0x79, 0xb8, 0x6e,
+  0x28, 0xd4, 0x05, 0x49, 0x8e, 0xf0, 0xa1, 0x25, 0xf0, 0x1f, 0xae, 0x33, 0x56, 0xca, 0x28, 0x0a,
+  0x97, 0x46, 0x40, 0x2c, 0xb2, 0x27, 0x09, 0x44, 0x0a, 0xa8, 0x48, 0x91, 0x8b, 0x92, 0xf0, 0x15,
+  0x25, 0x45, 0xcb, 0x22, 0x72, 0x20, 0x24, 0xf7, 0x54, 0x4e, 0x50, 0xbc, 0x7d, 0xa0, 0xc4, 0x34,
+  0x1a, 0xc0, 0xf2, 0x9a, 0x4e, 0x7a, 0x17, 0x4a, 0x07, 0xbd, 0xc2, 0xe1, 0x9a, 0xcc, 0xb1, 0x92,
+  0xd2, 0x4a, 0x70, 0x72, 0x52, 0x36, 0x04, 0x88, 0x22, 0x6b, 0xa9, 0xa2, 0x04, 0xec, 0x90, 0xac,
+  0x60, 0x09, 0xc5, 0x46, 0x10, 0x23, 0xe1, 0x89, 0xa9, 0x15, 0xee, 0x70, 0x4d, 0x59, 0xe2, 0xa8,
+  0x54, 0x04, 0x49, 0x29, 0x66, 0x1d, 0xc7, 0xc4, 0xfb, 0xc3, 0x35, 0x67, 0x00, 0x95, 0x07, 0xe0,
+  0x89, 0x21, 0x8d, 0x80, 0x57, 0x31, 0xd0, 0xd2, 0x06, 0x5b, 0x32, 0x7a, 0x09, 0x20, 0x3e, 0x18,
+  0x80, 0x26, 0x52, 0x65, 0x08, 0x3a, 0x42, 0x51, 0xa7, 0xec, 0xe1, 0x1a, 0x6c, 0x14, 0x2c, 0x35,
+  0x70, 0x86, 0x4c, 0x98, 0xa7, 0x38, 0x59, 0x7f, 0xb8, 0x26, 0x59, 0xd2, 0x93, 0xf7, 0x1c, 0xd7,
+  0x11, 0x3a, 0x1a, 0x2d, 0xf1, 0x55, 0xc1, 0x97, 0x54, 0x01, 0x35, 0x89, 0x52, 0x5c, 0x8c, 0xac,
+  0x0a, 0x94, 0x1b, 0x21, 0x52, 0x56, 0xe0, 0x90, 0x26, 0x84, 0x81, 0x14, 0x3b, 0x14, 0x4b, 0x24,
+  0x3e, 0x5e, 0x8b, 0x94, 0xb5, 0x48, 0x20, 0x38, 0xc8, 0x9b, 0xc3, 0x35, 0x83, 0x51, 0x41, 0x49,
+  0x4a, 0x49, 0x4a, 0x33, 0x69, 0x2d, 0x25, 0xab, 0x8c, 0xe1, 0xe8, 0x81, 0x8a, 0x1b, 0x63, 0x3f,
+  0xa8, 0x92, 0xf1, 0x57, 0x4a, 0x4b, 0x0e, 0x3e, 0x7a, 0xe8, 0xa9, 0x42, 0xa0, 0x42, 0x49, 0xd8,
+  0xaa, 0x09, 0xe7, 0x38, 0x6a, 0x3d, 0x71, 0xd0, 0x86, 0x34, 0xb7, 0xa4, 0x32, 0x41, 0x23, 0x1e,
+  0x3d, 0x34, 0x50, 0xc5, 0x58, 0x49, 0x36, 0x41, 0xd1, 0x48, 0x55, 0x89, 0xd8, 0x86, 0xa3, 0x35,
+  0x7b, 0x17, 0x15, 0x02, 0x56, 0x52, 0x21, 0xf2, 0xa8, 0x71, 0x1e, 0x3c, 0xcc, 0xe1, 0x9a, 0x12,
+  0xd9, 0x04, 0x72, 0xb8, 0x12, 0x54, 0x51, 0xc9, 0x6e, 0xb8, 0x5a, 0xda, 0xc3, 0xf5, 0x5c, 0xcb,
+  0x10, 0x94, 0x48, 0xe1, 0xd6, 0xec, 0x2e, 0x67, 0x09, 0x42, 0x68, 0x77, 0xb4, 0x56, 0x81, 0xab,
+  0x19, 0xea, 0x21, 0x50, 0xc2, 0x30, 0xf6, 0x09, 0x97, 0x5a, 0x1f, 0xae, 0xb3, 0x97, 0x12, 0x66,
+  0x0b, 0x47, 0xa8, 0x74, 0xda, 0x15, 0xd4, 0xca, 0x50, 0xa4, 0xc5, 0x7e, 0x71, 0x0e, 0x21, 0x68,
+  0x1c, 0x48, 0x07, 0xc1, 0xf5, 0xcf, 0xe9, 0x44, 0x49, 0xc6, 0x2b, 0x5d, 0x48, 0x0d, 0xe4, 0x46,
+  0x7a, 0x5b, 0x50, 0x49, 0x67, 0xa0, 0x73, 0x55, 0xf6, 0x50, 0x38, 0x49, 0x60, 0x0f, 0x72, 0xd3,
+  0x12, 0x9a, 0xac, 0x32, 0xd4, 0xf0, 0x28, 0x27, 0x28, 0xfc, 0x94, 0xb2, 0xa4, 0x6b, 0x62, 0x60,
+  0x3d, 0x15, 0x06, 0x58, 0x90, 0x6c, 0x2d, 0x92, 0xad, 0x82, 0xd3, 0x14, 0x85, 0x1c, 0xcf, 0x51,
+  0x87, 0xe4, 0xac, 0x82, 0x9d, 0x95, 0xd4, 0x02, 0xd2, 0x12, 0xcf, 0xe4, 0xeb, 0x82, 0x7d, 0x9d,
+  0xf1, 0xbb, 0x80, 0x22, 0x45, 0x8a, 0x08, 0x84, 0x9c, 0xc2, 0x85, 0xf6, 0xc0, 0xe1, 0xea, 0x53,
+  0x1f, 0x28, 0x52, 0x94, 0x99, 0x14, 0x66, 0x01, 0xbd, 0x91, 0x73, 0x8d, 0x00, 0x81, 0x7a, 0x60,
+  0x53, 0xfa, 0xb1, 0x8c, 0xc8, 0x60, 0xd7, 0x9c, 0x34, 0x12, 0xad, 0x28, 0x41, 0x2a, 0x9b, 0x8f,
+  0x5a, 0xf8, 0x05, 0xac, 0xa4, 0x63, 0x5c, 0xea, 0x82, 0x71, 0xc9, 0x85, 0xc8, 0x4a, 0x0e, 0x0a,
+  0x45, 0x5d, 0x30, 0x0b, 0x74, 0x79, 0x46, 0x38, 0x65, 0x0a, 0x23, 0x1c, 0xb1, 0xe4, 0x48, 0xc7,
+  0xa8, 0xa9, 0x2a, 0x60, 0x08, 0xa0, 0x0e, 0x42, 0xa9, 0x42, 0xea, 0x20, 0x53, 0xb2, 0xd9, 0x05,
+  0x54, 0x17, 0xa0, 0xb6, 0x33, 0x73, 0xa7, 0xe1, 0x4c, 0x9b, 0x15, 0x10, 0x28, 0x6c, 0x9c, 0xd8,
+  0x04, 0x0a, 0xf8, 0x20, 0x65, 0x2a, 0x15, 0x25, 0xcb, 0xdd, 0xcb, 0xa4, 0x0c, 0xa6, 0x4a, 0x10,
+  0xd9, 0xd3, 0x73, 0xbb, 0x9a, 0x59, 0x63, 0x74, 0x99, 0xfd, 0xca, 0x05, 0xa3, 0x9c, 0x0b, 0x46,
+  0xe2, 0xed, 0x3d, 0x55, 0x25, 0x11, 0xb9, 0xb5, 0xa3, 0x4e, 0xed, 0x2a, 0x8e, 0xe4, 0xce, 0x68,
+  0x79, 0x6a, 0xf1, 0x8c, 0x7d, 0x61, 0x3c, 0x57, 0x2e, 0x55, 0x86, 0x9d, 0xeb, 0x88, 0x02, 0xd6,
+  0x60, 0x97, 0xb5, 0x27, 0x11, 0xfb, 0xd2, 0x27, 0x24, 0x37, 0x6d, 0xcb, 0x95, 0xd9, 0x53, 0x7b,
+  0x77, 0x31, 0x95, 0x53, 0x2a, 0x6e, 0x5c, 0x42, 0x21, 0x9b, 0x10, 0x28, 0x02, 0x17, 0x5f, 0x52,
+  0x2c, 0x38, 0x33, 0xaf, 0xe7, 0x4a, 0xcc, 0x32, 0x30, 0x25, 0x16, 0x77, 0x55, 0x5c, 0x17, 0xfb,
+  0x2a, 0xce, 0xd8, 0x89, 0x54, 0x98, 0x55, 0x4c, 0x1d, 0x20, 0x94, 0xa9, 0x03, 0x94, 0xa9, 0x7e,
+  0xc2, 0x0e, 0x45, 0x2f, 0x34, 0x15, 0x05, 0xc3, 0x63, 0x84, 0x76, 0xe4, 0x5c, 0xb4, 0x12, 0x6e,
+  0x3d, 0xae, 0xe4, 0xd6, 0x33, 0x3b, 0x43, 0x71, 0x81, 0x12, 0x9c, 0xb4, 0xb4, 0xe6, 0x16, 0x05,
+  0x41, 0xe4, 0x6a, 0x2e, 0xae, 0xc2, 0xef, 0x12, 0x36, 0x95, 0x95, 0x5d, 0x8f, 0x13, 0xd0, 0x89,
+  0xa7, 0x08, 0x28, 0x1f, 0xa8, 0xa3, 0x58, 0x48, 0x9c, 0xbb, 0xe4, 0x1c, 0x43, 0x80, 0xd4, 0xa1,
+  0x79, 0x72, 0xa3, 0x8d, 0x65, 0xea, 0xb4, 0xbb, 0xd8, 0xc3, 0x02, 0xf8, 0x5d, 0x39, 0x6e, 0xd5,
+  0x28, 0x06, 0xdc, 0xaa, 0x53, 0x84, 0x2c, 0x24, 0x47, 0x1a, 0x07, 0xbd, 0x4f, 0xed, 0x9e, 0x07,
+  0x4e, 0x6a, 0xf7, 0x82, 0xbd, 0x85, 0xee, 0x12, 0x89, 0x29, 0x46, 0x14, 0x45, 0xb3, 0xa6, 0xa7,
+  0x1a, 0x4d, 0x9d, 0x93, 0x27, 0x07, 0x22, 0x0a, 0x0e, 0xca, 0x12, 0x11, 0xd9, 0xae, 0xe6, 0x01,
+  0x32, 0x4d, 0x21, 0x45, 0x9a, 0x42, 0x28, 0x5c, 0x5a, 0xf1, 0x3c, 0x47, 0x49, 0x2e, 0x2d, 0x39,
+  0x9a, 0x0a, 0x1b, 0x8f, 0x33, 0x45, 0x1a, 0x67, 0x4a, 0x9a, 0x1c, 0x28, 0xbe, 0x5e, 0x12, 0xdc,
+  0x03, 0x67, 0x89, 0xe1, 0xd7, 0x94, 0x3e, 0x3c, 0x19, 0xcd, 0xf6, 0x80, 0x25, 0xed, 0x9a, 0x19,
+  0x9d, 0x45, 0x9a, 0xad, 0x92, 0x3d, 0x1a, 0x48, 0x75, 0x34, 0x6a, 0x72, 0x0f, 0xd2, 0x09, 0x7d,
+  0xbb, 0x40, 0xcb, 0xc8, 0xa3, 0x0b, 0xd5, 0x1e, 0xae, 0x09, 0x3c, 0x1c, 0xcc, 0x4c, 0x69, 0xe2,
+  0xa4, 0x03, 0x54, 0x0c, 0x1c, 0x07, 0x5b, 0xf9, 0xfd, 0x2b, 0x9e, 0xaa, 0xd2, 0x68, 0xc9, 0xa7,
+  0xa4, 0xcb, 0x76, 0xd8, 0xe1, 0xb0, 0x25, 0xe8, 0x72, 0xaf, 0xc6, 0x6c, 0x3a, 0x1f, 0xf3, 0x3c,
+  0x54, 0x63, 0x80, 0x26, 0x96, 0x9e, 0xac, 0xa5, 0xd9, 0x76, 0x36, 0x81, 0x47, 0x57, 0xe4, 0x2e,
+  0xcf, 0xc6, 0xdc, 0x7d, 0x30, 0x1b, 0xa7, 0x6a, 0xa1, 0x2c, 0xf5, 0x26, 0xcf, 0xe9, 0x08, 0x23,
+  0xcb, 0xfd, 0x78, 0x0d, 0x4d, 0xd0, 0x33, 0x90, 0xff, 0x9e, 0x27, 0x06, 0x34, 0x43, 0xf8, 0x57,
+  0x21, 0x79, 0x12, 0xd2, 0xe6, 0x69, 0x9d, 0x92, 0x82, 0xaa, 0x90, 0x92, 0x14, 0x6f, 0x06, 0x91,
+  0xe3, 0x11, 0xc3, 0x51, 0xc3, 0x49, 0x73, 0x3f, 0x17, 0x2c, 0x1a, 0x24, 0x85, 0x66, 0xd3, 0xa0,
+  0x01, 0x24, 0x7a, 0xc3, 0x57, 0x08, 0x59, 0xa6, 0x2b, 0x84, 0xe4, 0x56, 0xea, 0x81, 0x6b, 0xca,
+  0x77, 0x87, 0xbe, 0xa2, 0x30, 0xb1, 0x72, 0xf2, 0xa3, 0x92, 0xa6, 0xab, 0x48, 0x8f, 0xc3, 0x9c,
+  0x5f, 0xda, 0x9a, 0x97, 0x52, 0xc0, 0xfb, 0x34, 0x39, 0x03, 0x6d, 0x5a, 0xaa, 0xe2, 0xde, 0xdd,
+  0xe6, 0xfe, 0xf3, 0xc7, 0x7c, 0x41, 0xbf, 0x09, 0xe0, 0x0e, 0xc5, 0x57, 0xa8, 0xdb, 0xbf, 0x7f,
+  0x6c, 0x07, 0x5c, 0x15, 0xb3, 0x16, 0x57, 0xe5, 0x75, 0xbb, 0xce, 0xe0, 0xe4, 0x6e, 0x3d, 0xb5,
+  0x43, 0x7d, 0x31, 0x75, 0x6f, 0xb3, 0x75, 0xfa, 0x79, 0x60, 0xbd, 0xb9, 0x98, 0xea, 0x11, 0x17,
+  0x55, 0xba, 0x47, 0x9d, 0x9c, 0xf1, 0x9d, 0x71, 0x7b, 0xd5, 0x8f, 0x6d, 0xb9, 0xdd, 0x80, 0x7a,
+  0xcc, 0xb3, 0x71, 0x1a, 0x36, 0x17, 0xb8, 0xa7, 0x7d, 0xa1, 0xa4, 0xc2, 0xc5, 0x69, 0xb7, 0x51,
+  0xce, 0xb7, 0x3f, 0x38, 0x73, 0x77, 0x51, 0x6d, 0xba, 0xa1, 0xe9, 0xdb, 0xdd, 0x65, 0xf6, 0x80,
+  0x4b, 0x7e, 0xc7, 0xf6, 0x47, 0xde, 0xf8, 0x51, 0xe4, 0x19, 0xff, 0x06, 0xb2, 0xcc, 0xdf, 0xb4,
+  0x97, 0xdb, 0xcd, 0x50, 0xf7, 0xd9, 0x97, 0xff, 0xfc, 0x47, 0x7d, 0x51, 0x5f, 0x3c, 0xcd, 0xb3,
+  0x06, 0xb7, 0xc6, 0x88, 0x9c, 0xc4, 0xea, 0xc3, 0x32, 0x57, 0x3e, 0xcf, 0x86, 0x65, 0x6e, 0xf2,
+  0xdd, 0x65, 0xf7, 0x6b, 0x6f, 0x5e, 0xea, 0x97, 0x64, 0xec, 0xff, 0x2b, 0x55, 0xee, 0xa5, 0xbe,
+  0xac, 0x87, 0xcd, 0xd4, 0xad, 0x58, 0xe8, 0x79, 0xf6, 0xaa, 0xbe, 0xa4, 0x9f, 0x15, 0x66, 0xd1,
+  0x52, 0xf8, 0x24, 0xd9, 0xca, 0x47, 0x93, 0xac, 0xf6, 0x92, 0x5f, 0x0c, 0x75, 0x73, 0xde, 0x91,
+  0xbd, 0xdf, 0x6e, 0xfa, 0xa7, 0x19, 0xae, 0xba, 0x9b, 0x7e, 0x96, 0xab, 0x66, 0xb9, 0x41, 0x3c,
+  0x9a, 0x5c, 0xfd, 0x80, 0xdc, 0xfa, 0xd3, 0x4f, 0x49, 0xb0, 0x8f, 0x8f, 0x2e, 0xd7, 0xec, 0xe5,
+  0xfe, 0xa5, 0x5e, 0xb1, 0xd4, 0x17, 0x5d, 0xdf, 0x5e, 0x1c, 0xdb, 0xab, 0x55, 0x92, 0x0b, 0xfc,
+  0x3e, 0x9a, 0x60, 0xfb, 0x80, 0xe0, 0x3b, 0x83, 0xcd, 0xe3, 0x0b, 0x76, 0x7b, 0xc1, 0xcf, 0xb7,
+  0x5d, 0xc3, 0x7e, 0xae, 0xfb, 0xed, 0x1e, 0x52, 0x22, 0x49, 0xf4, 0x81, 0x05, 0xda, 0x47, 0x10,
+  0xe8, 0xf7, 0x02, 0xbf, 0x69, 0x2f, 0x53, 0x06, 0x7d, 0x4b, 0x99, 0x7c, 0xcf, 0xc9, 0x62, 0x0e,
+  0x2e, 0x06, 0x84, 0x47, 0xb3, 0x35, 0x3c, 0x28, 0x7a, 0xef, 0xe6, 0xe8, 0x1f, 0x5f, 0x74, 0xdc,
+  0x8b, 0xfe, 0x6e, 0xb3, 0xed, 0xbb, 0xa9, 0x25, 0xe1, 0xaf, 0xba, 0x8f, 0xd9, 0xf3, 0xe1, 0x82,
+  0x54, 0x38, 0x36, 0x5e, 0xca, 0x59, 0x03, 0x67, 0x1f, 0xaf, 0x88, 0x88, 0xff, 0x45, 0x85, 0x3b,
+  0x27, 0xd8, 0xdf, 0x40, 0x05, 0x79, 0xa0, 0xc2, 0x88, 0x92, 0xde, 0x6d, 0x86, 0xec, 0x4d, 0x77,
+  0x4a, 0x78, 0x3f, 0x32, 0x7f, 0x97, 0x60, 0xf1, 0xf1, 0x32, 0x5b, 0xaa, 0x07, 0x65, 0xdf, 0xd9,
+  0x6d, 0x7e, 0x03, 0xd9, 0x77, 0xe5, 0xec, 0xd5, 0x66, 0x18, 0xeb, 0xbe, 0x1b, 0xb3, 0xef, 0xda,
+  0x15, 0x3e, 0x8f, 0xac, 0x16, 0x3b, 0xc9, 0xe1, 0xf1, 0x24, 0x9b, 0x07, 0x24, 0xdf, 0xd9, 0xec,
+  0x7e, 0x03, 0xc9, 0x77, 0x15, 0xed, 0xf5, 0xd5, 0x29, 0x4e, 0x5c, 0x77, 0xf5, 0x1a, 0xf9, 0x76,
+  0xfb, 0xcb, 0x76, 0xb8, 0xbd, 0x69, 0x6e, 0x6f, 0x76, 0x1d, 0x73, 0x6f, 0xb7, 0x53, 0x0f, 0x08,
+  0x4f, 0xf3, 0x41, 0xfa, 0x18, 0xaf, 0xf9, 0x6b, 0xfe, 0x21, 0xfa, 0xf8, 0xa7, 0xe8, 0xba, 0x99,
+  0xae, 0xea, 0x69, 0x33, 0x94, 0x4d, 0x3d, 0xac, 0xc6, 0x7f, 0xfb, 0x51, 0xfa, 0x3f, 0x11, 0xef,
+  0xc9, 0xd8, 0x8e, 0xdd, 0xfe, 0xd1, 0xf9, 0x43, 0x81, 0xfb, 0x1f, 0xc1, 0xf7, 0x8b, 0xb1, 0x19,
+  0xba, 0xed, 0x94, 0x8d, 0x43, 0xb3, 0xcc, 0x17, 0xf5, 0x76, 0x5b, 0xfd, 0x8d, 0xfe, 0xf9, 0xa1,
+  0xd0, 0x2b, 0xde, 0x0a, 0x21, 0xc3, 0xaa, 0xf5, 0x4d, 0x2b, 0x6a, 0xe2, 0x92, 0x28, 0xc9, 0x80,
+  0xf4, 0xef, 0x8f, 0x93, 0x45, 0xfa, 0xd7, 0xcf, 0xbf, 0x00, 0xe8, 0x59, 0x52, 0x9f, 0x0b, 0x1a,
+  0x00, 0x00,
+};
+
+const WebAsset WEB_ASSETS[] = {
+  { "/style.css", "text/css", "public, max-age=31536000, immutable", "\"8730d813b55cd9b9\"", STYLE_CSS_GZ, sizeof(STYLE_CSS_GZ) },
+  { "/app.js", "application/javascript", "public, max-age=31536000, immutable", "\"2132f0018de7ce0a\"", APP_JS_GZ, sizeof(APP_JS_GZ) },
+  { "/", "text/html", "no-cache", "\"15f4ab8b42687c3a\"", INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ) },
+};
+
+#endif